@@ -0,0 +1,2 @@
+if "%~1"=="" (set LIX=.\_build\lix.exe) else (set LIX=%~1)
+"%LIX%" --image ".\stdlib\prelude.lx" ".\src\lib\prelude.image.c"
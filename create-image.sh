@@ -0,0 +1,3 @@
+#! /bin/bash
+
+"${1:-./_build/lix}" --image "./stdlib/prelude.lx" "./src/lib/prelude.image.c"
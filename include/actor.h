@@ -0,0 +1,161 @@
+#ifndef LIX_ACTOR_H
+#define LIX_ACTOR_H
+
+#include <lval.h>
+#include <pool.h>
+#include <types.h>
+
+
+/// \brief Maximum messages an actor handles per turn.
+///
+/// \details Bounds how long one busy actor holds a
+/// worker before it is queued behind other tasks again.
+#define LACTOR_BATCH 64
+
+
+/// \brief Represents a message in a mailbox.
+///
+/// A `lmsg` consists of a:
+/// - next      : atomic lmsg* corresponding to the next (newer) message
+/// - val       : lval* corresponding to the message itself
+typedef struct lmsg
+{
+    struct lmsg* _Atomic next;
+    lval* val;
+} lmsg;
+
+
+/// \brief Represents a lock-free multi-producer,
+/// single-consumer queue of messages.
+///
+/// Senders swap themselves into `head` with a single
+/// atomic exchange and then link the previous head to the
+/// new message; the one consumer walks from `tail`. `stub`
+/// keeps the queue from ever being empty of nodes.
+///
+/// A `lmbox` consists of a:
+/// - head      : atomic lmsg* corresponding to the newest message
+/// - tail      : lmsg* corresponding to the oldest message
+/// - stub      : lmsg used as a placeholder node
+/// - count     : atomic int corresponding to the number of queued messages
+typedef struct lmbox
+{
+    lmsg* _Atomic head;
+    lmsg* tail;
+    lmsg stub;
+
+    _Atomic int count;
+} lmbox;
+
+
+/// \brief Represents an actor
+///
+/// An actor calls its behaviour on each message sent to
+/// it, one at a time and in the order they arrived, on
+/// the worker pool of the instance that created it. Results
+/// other than `()` are queued in `outbox` for `receive`.
+///
+/// A `lactor` consists of a:
+/// - refs      : atomic int corresponding to the number of owners
+/// - behaviour : lval* corresponding to the function called on each message
+/// - env       : lenv* corresponding to the snapshot the behaviour runs in
+/// - ctx       : lctx corresponding to the context of the actor
+/// - inbox     : lmbox corresponding to the messages not yet handled
+/// - outbox    : lmbox corresponding to the results not yet received
+/// - runs      : lpool_group counting the turns queued or running
+/// - scheduled : atomic int set while a turn is queued or running
+/// - receiving : atomic int set while a thread is receiving from the actor
+/// - sent      : atomic long corresponding to the messages sent
+/// - processed : atomic long corresponding to the messages handled
+/// - received  : atomic long corresponding to the results received
+/// - errors    : atomic long corresponding to the messages that produced errors
+/// - peak      : atomic int corresponding to the deepest the inbox has been
+typedef struct lactor
+{
+    _Atomic int refs;
+
+    lval* behaviour;
+    lenv* env;
+    lctx ctx;
+
+    lmbox inbox;
+    lmbox outbox;
+
+    lpool_group runs;
+    _Atomic int scheduled;
+    _Atomic int receiving;
+
+    _Atomic long sent;
+    _Atomic long processed;
+    _Atomic long received;
+    _Atomic long errors;
+    _Atomic int peak;
+} lactor;
+
+
+/////////////////////////////
+/// `lactor` Constructors ///
+/////////////////////////////
+
+/// \brief Constructs an actor with the behaviour `f`.
+///
+/// \details Constructs an actor calling `f` in a snapshot
+/// of `e`. Takes ownership of `f`. `e` must belong to an
+/// interpreter instance.
+///
+/// \param e - type: lenv*
+/// \param f - type: lval*
+/// \return lactor*
+lactor* lactor_new(lenv* e, lval* f);
+
+
+/// \brief Adds a reference to the actor `a`.
+///
+/// \param a - type: lactor*
+/// \return lactor*
+lactor* lactor_ref(lactor* a);
+
+
+/// \brief Drops a reference to the actor `a`.
+///
+/// \details Drops a reference to the actor `a` and frees
+/// it, along with any messages and results it still holds,
+/// once the last reference is gone.
+///
+/// \param a - type: lactor*
+void lactor_unref(lactor* a);
+
+
+////////////////////////
+/// `lactor` Methods ///
+////////////////////////
+
+/// \brief Sends the message `v` to the actor `a`.
+///
+/// \details Queues `v` in the inbox of `a`, taking
+/// ownership of it so it is handed to the behaviour
+/// without being copied, and schedules a turn of `a` if
+/// none is pending.
+///
+/// \param a - type: lactor*
+/// \param v - type: lval*
+void lactor_send(lactor* a, lval* v);
+
+
+/// \brief Takes the next result of the actor `a`.
+///
+/// \details Returns the oldest result of `a` not yet
+/// received. If there is none, waits (running other tasks)
+/// until `a` has handled every message sent to it and, if
+/// `wait_all` is set, until the whole pool has gone quiet.
+/// Returns an error if there is still no result or another
+/// thread is already receiving from `a`. Receiving within a
+/// cycle of actors receiving from each other deadlocks.
+///
+/// \param a - type: lactor*
+/// \param wait_all - type: int
+/// \return lval*
+lval* lactor_receive(lactor* a, int wait_all);
+
+
+#endif  /// LIX_ACTOR_H
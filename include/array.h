@@ -0,0 +1,86 @@
+#ifndef LIX_ARRAY_H
+#define LIX_ARRAY_H
+
+#include <lval.h>
+#include <types.h>
+
+
+///////////////////////////
+/// `larr` Constructors ///
+///////////////////////////
+
+/// \brief Constructs an empty array.
+///
+/// \details Constructs an empty array with room
+/// for `cap` items before it needs to grow.
+///
+/// \param cap - type: int
+/// \return larr*
+larr* larr_new(int cap);
+
+
+/// \brief Adds a reference to the array `a`.
+///
+/// \param a - type: larr*
+/// \return larr*
+larr* larr_ref(larr* a);
+
+
+/// \brief Drops a reference to the array `a`.
+///
+/// \details Drops a reference to the array `a` and
+/// frees it along with its items once the last
+/// reference is gone.
+///
+/// \param a - type: larr*
+void larr_unref(larr* a);
+
+
+//////////////////////
+/// `larr` Methods ///
+//////////////////////
+
+/// \brief Appends the item `x` to the array `a`.
+///
+/// \details Appends the item `x` to the array `a`,
+/// doubling its capacity when full so pushes are
+/// amortised O(1). Takes ownership of `x`.
+///
+/// \param a - type: larr*
+/// \param x - type: lval*
+void larr_push(larr* a, lval* x);
+
+
+/// \brief Copies the items of the array `a` into a Q-Expression.
+///
+/// \param a - type: larr*
+/// \return lval*
+lval* larr_freeze(larr* a);
+
+
+/// \brief Returns whether the array `a` can be reached from `v`.
+///
+/// \details Returns whether `v` is the array `a` or holds
+/// it, through arrays, expressions, maps, sets, sequences,
+/// generators, the value of a future (waiting for it) or the
+/// arguments bound to a partially applied function.
+/// Storing such a `v` into `a` would make a cycle, which
+/// reference counting never frees and printing never ends.
+///
+/// \param v - type: lval*
+/// \param a - type: larr*
+/// \return int
+int larr_reaches(lval* v, larr* a);
+
+
+/// \brief Moves the items of the Q-Expression `q` into an array.
+///
+/// \details Moves the items of the Q-Expression `q` into
+/// a new array and frees `q`.
+///
+/// \param q - type: lval*
+/// \return larr*
+larr* larr_thaw(lval* q);
+
+
+#endif  /// LIX_ARRAY_H
@@ -140,6 +140,641 @@ lval* builtin_eval(lenv* e, lval* a);
 lval* builtin_join(lenv* e, lval* a);
 
 
+//////////////////////////////////
+/// Builtin Sequence Operators ///
+//////////////////////////////////
+
+/// \brief Constructs a lazy range of numbers.
+///
+/// \details Constructs a lazy range of numbers. Takes
+/// an end, a start and end or a start, end and step.
+/// The end is exclusive and no list is ever built.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_range(lenv* e, lval* a);
+
+
+/// \brief Converts a Q-Expression into a lazy sequence.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_seq(lenv* e, lval* a);
+
+
+/// \brief Lazily maps a function over a sequence.
+///
+/// \details Returns a sequence that applies the function
+/// to each item of a sequence or Q-Expression as it is pulled.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_seq_map(lenv* e, lval* a);
+
+
+/// \brief Lazily filters a sequence.
+///
+/// \details Returns a sequence that only yields the items
+/// of a sequence or Q-Expression for which the predicate
+/// returns a non-zero Number.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_seq_filter(lenv* e, lval* a);
+
+
+/// \brief Lazily takes the first N items of a sequence.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_seq_take(lenv* e, lval* a);
+
+
+/// \brief Lazily takes items of a sequence while a predicate holds.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_seq_take_while(lenv* e, lval* a);
+
+
+/// \brief Folds a sequence from the left.
+///
+/// \details Pulls every item of a sequence or Q-Expression
+/// through its pipeline in a single pass, combining each
+/// with the accumulator using the function given.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_fold(lenv* e, lval* a);
+
+
+/// \brief Collects a sequence into a Q-Expression.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_collect(lenv* e, lval* a);
+
+
+///////////////////////////////
+/// Builtin Array Operators ///
+///////////////////////////////
+
+/// \brief Constructs a mutable array.
+///
+/// \details Constructs a mutable array holding N copies
+/// of an item (0 if not given). `(make-array 0)` gives
+/// an empty array to `push!` onto.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_make_array(lenv* e, lval* a);
+
+
+/// \brief Returns a copy of the item at an index of an array.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_aget(lenv* e, lval* a);
+
+
+/// \brief Replaces the item at an index of an array in place.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_aset(lenv* e, lval* a);
+
+
+/// \brief Appends an item to the end of an array in place.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_push(lenv* e, lval* a);
+
+
+/// \brief Returns the number of items in an array.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_alen(lenv* e, lval* a);
+
+
+/// \brief Copies the items of an array into a Q-Expression.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_freeze(lenv* e, lval* a);
+
+
+/// \brief Converts a Q-Expression into a mutable array.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_thaw(lenv* e, lval* a);
+
+
+//////////////////////////////
+/// Builtin Hash Operators ///
+//////////////////////////////
+
+/// \brief Constructs a Hash-Map.
+///
+/// \details Constructs a Hash-Map from a Q-Expression
+/// of `{key value}` pairs. Later pairs replace earlier
+/// ones with an equal key.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_hash_map(lenv* e, lval* a);
+
+
+/// \brief Constructs a Hash-Set.
+///
+/// \details Constructs a Hash-Set from the items of a
+/// Q-Expression.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_hash_set(lenv* e, lval* a);
+
+
+/// \brief Returns a Hash-Map or Hash-Set with an entry added.
+///
+/// \details Returns a new Hash-Map with a key bound to
+/// a value or a new Hash-Set with an item added. The
+/// original is unchanged and shares its structure with
+/// the result.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_insert(lenv* e, lval* a);
+
+
+/// \brief Returns a Hash-Map or Hash-Set with an entry removed.
+///
+/// \details Returns a new Hash-Map or Hash-Set without a
+/// key. The original is unchanged and shares its structure
+/// with the result.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_remove(lenv* e, lval* a);
+
+
+/// \brief Looks up the value of a key in a Hash-Map.
+///
+/// \details Returns a copy of the value bound to a key
+/// in a Hash-Map, or the default given if the key is
+/// absent. Returns an error if the key is absent and no
+/// default is given.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_get(lenv* e, lval* a);
+
+
+/// \brief Checks if a Hash-Map or Hash-Set holds a key.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_contains(lenv* e, lval* a);
+
+
+/// \brief Returns the keys of a Hash-Map or items of a Hash-Set.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_keys(lenv* e, lval* a);
+
+
+/// \brief Returns the values of a Hash-Map.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_vals(lenv* e, lval* a);
+
+
+/// \brief Returns the number of entries in a Hash-Map or Hash-Set.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_size(lenv* e, lval* a);
+
+
+/////////////////////////////////
+/// Builtin Sorting Operators ///
+/////////////////////////////////
+
+/// \brief Sorts a Q-Expression or Array.
+///
+/// \details Returns a sorted copy of a Q-Expression or
+/// Array ordered by lval_cmp. Large inputs are sorted on
+/// multiple threads.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_sort(lenv* e, lval* a);
+
+
+/// \brief Sorts a Q-Expression or Array with a comparator.
+///
+/// \details Returns a stably sorted copy of a Q-Expression
+/// or Array, using a function as a "less than" predicate.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_sort_by(lenv* e, lval* a);
+
+
+/// \brief Searches a sorted Q-Expression or Array for an item.
+///
+/// \details Returns the index of an item in a Q-Expression
+/// or Array sorted as by `sort`, or -1 if it is not found.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_binary_search(lenv* e, lval* a);
+
+
+//////////////////////////////////
+/// Builtin Parallel Operators ///
+//////////////////////////////////
+
+/// \brief Maps a function over a sequence in parallel.
+///
+/// \details Returns a Q-Expression of the results of
+/// applying a function to each item of a sequence, in
+/// item order, evaluating chunks of items on the worker
+/// pool. `def` inside the function binds locally.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_pmap(lenv* e, lval* a);
+
+
+/// \brief Filters a sequence in parallel.
+///
+/// \details Returns a Q-Expression of the items of a
+/// sequence for which a predicate is true, in item order,
+/// testing chunks of items on the worker pool.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_pfilter(lenv* e, lval* a);
+
+
+/// \brief Reduces a sequence in parallel.
+///
+/// \details Reduces a sequence with an associative
+/// function and an initial value. Each chunk of items is
+/// folded on the worker pool and the chunk results are
+/// then folded in order starting from the initial value,
+/// so the result is the same for any number of workers
+/// with a given chunk size.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_preduce(lenv* e, lval* a);
+
+
+/// \brief Configures the parallel builtins.
+///
+/// \details Sets the number of worker threads (0 for one
+/// per CPU) and the number of items per task (0 to pick
+/// automatically) used by `pmap`, `pfilter` and `preduce`.
+/// The pool is restarted if the number of workers changes.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_parallel_config(lenv* e, lval* a);
+
+
+//////////////////////////////
+/// Builtin Task Operators ///
+//////////////////////////////
+
+/// \brief Spawns a task evaluating a Q-Expression.
+///
+/// \details Returns a future for the value of a
+/// Q-Expression evaluated on the worker pool in a snapshot
+/// of the calling environment. `def` inside the task binds
+/// in the snapshot. Globals and arrays stay shared.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_spawn(lenv* e, lval* a);
+
+
+/// \brief Waits for the value of a future.
+///
+/// \details Returns the value (or error) of the task
+/// behind a future, helping to run other tasks until it
+/// is ready. A future can be awaited any number of times.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_await(lenv* e, lval* a);
+
+
+///////////////////////////////
+/// Builtin Actor Operators ///
+///////////////////////////////
+
+/// \brief Creates an actor.
+///
+/// \details Returns an actor that calls a function on
+/// each message sent to it, one message at a time, on the
+/// worker pool. The function runs in a snapshot of the
+/// calling environment. Results other than `()` are kept
+/// for `receive`.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_actor(lenv* e, lval* a);
+
+
+/// \brief Sends a message to an actor.
+///
+/// \details Queues a message for an actor without
+/// waiting for it to be handled. The message is moved
+/// into the mailbox rather than copied.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_send(lenv* e, lval* a);
+
+
+/// \brief Receives the next result of an actor.
+///
+/// \details Returns the oldest result of an actor not
+/// yet received, waiting for the actor (and, outside of
+/// tasks, for every other actor and task) to finish its
+/// work if there is none. Returns an error if no result
+/// is left.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_receive(lenv* e, lval* a);
+
+
+/// \brief Returns the statistics of an actor.
+///
+/// \details Returns a Hash-Map of the messages `sent` to
+/// an actor, the messages it `processed`, the results
+/// `received` from it, the messages that produced `errors`,
+/// the messages still `queued` and the `peak` depth of
+/// its mailbox.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_actor_stats(lenv* e, lval* a);
+
+
+///////////////////////////////////
+/// Builtin Generator Operators ///
+///////////////////////////////////
+
+/// \brief Creates a generator.
+///
+/// \details Returns a generator that evaluates a
+/// Q-Expression in a snapshot of the calling environment,
+/// pausing at each `yield` until the next value is asked
+/// for. Generators can be used wherever a sequence is
+/// expected, so a producer streams its values one at a time.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_generator(lenv* e, lval* a);
+
+
+/// \brief Yields a value from a generator.
+///
+/// \details Hands a value to whoever asked the running
+/// generator for its next value and pauses until it is
+/// asked again.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_yield(lenv* e, lval* a);
+
+
+/// \brief Takes the next value of a generator.
+///
+/// \details Resumes a generator until it yields its
+/// next value. Once the generator has finished, returns
+/// the default value if one is given or an error otherwise.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_next(lenv* e, lval* a);
+
+
+///////////////////////////////
+/// Builtin Event Operators ///
+///////////////////////////////
+
+/// \brief Opens a file for the event loop.
+///
+/// \details Opens a file (or named pipe) for reading
+/// ("r"), writing ("w") or appending ("a") without
+/// blocking, returning its descriptor.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_open(lenv* e, lval* a);
+
+
+/// \brief Listens on a Unix-domain socket.
+///
+/// \details Listens on a Unix-domain socket at a path,
+/// returning the descriptor to pass to `io-accept`.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_listen(lenv* e, lval* a);
+
+
+/// \brief Connects to a Unix-domain socket.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_connect(lenv* e, lval* a);
+
+
+/// \brief Closes a descriptor of the event loop.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_close(lenv* e, lval* a);
+
+
+/// \brief Sets the function called with data read from a descriptor.
+///
+/// \details Calls a function with each String read from
+/// a descriptor while the event loop runs, and once with
+/// an empty String at end of file.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_read(lenv* e, lval* a);
+
+
+/// \brief Sets the function called with each new connection.
+///
+/// \details Calls a function with the descriptor of each
+/// connection accepted on a listening socket while the
+/// event loop runs.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_accept(lenv* e, lval* a);
+
+
+/// \brief Writes a String to a descriptor.
+///
+/// \details Queues a String to be written to a descriptor
+/// without blocking as the event loop runs. An optional function is called with
+/// the number of bytes once all of it is written.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_write(lenv* e, lval* a);
+
+
+/// \brief Calls a function after a delay.
+///
+/// \details Calls a function of no arguments once a
+/// number of milliseconds have passed while the event loop
+/// runs.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_timer(lenv* e, lval* a);
+
+
+/// \brief Runs the event loop.
+///
+/// \details Runs the event loop until nothing is left to
+/// wait for or, unless it is negative, a number of
+/// milliseconds have passed. Returns the number of callbacks
+/// run or the first error one returned.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_io_run(lenv* e, lval* a);
+
+
+////////////////////////////////
+/// Builtin Module Operators ///
+////////////////////////////////
+
+/// \brief Requires a module.
+///
+/// \details Returns the Module of the file at a path,
+/// evaluating the file in its own namespace the first time
+/// it is required by the instance and sharing it afterwards.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_require(lenv* e, lval* a);
+
+
+/// \brief Requires a module and binds it to a name.
+///
+/// \details Requires the module at a path and binds it
+/// with `def` to a symbol, through which its exports are
+/// reached as `name/symbol`.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_import(lenv* e, lval* a);
+
+
+/// \brief Exports symbols from the module being loaded.
+///
+/// \details Adds symbols to the exports of the module
+/// being evaluated. A module that never exports anything
+/// exposes every definition.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_export(lenv* e, lval* a);
+
+
+//////////////////////////////
+/// Builtin Heap Operators ///
+//////////////////////////////
+
+/// \brief Returns the heap counters.
+///
+/// \details Returns a Hash-Map of the lvals `live` now,
+/// the `peak` number live at once, those `allocated` and
+/// `freed`, the lvals (`copies`) and bytes (`copied-bytes`)
+/// duplicated by lval_copy, the environments (`env-copies`)
+/// and bindings (`env-bindings`) duplicated by lenv_copy,
+/// the `max-rss` of the process in kilobytes and, under
+/// `types`, a Hash-Map of the lvals live by type name.
+/// Takes a Q-Expression it ignores, as in `(heap-stats {})`.
+/// Returns an error unless the build defines
+/// LIX_HEAP_STATS.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_heap_stats(lenv* e, lval* a);
+
+
 //////////////////////////////////
 /// Builtin Function Operators ///
 //////////////////////////////////
@@ -225,11 +860,85 @@ lval* builtin_ne(lenv* e, lval* a);
 lval* builtin_if(lenv* e, lval* a);
 
 
+//////////////////////////////
+/// Builtin Loop Operators ///
+//////////////////////////////
+
+/// \brief Evaluates a body with rebindable loop variables.
+///
+/// \details Binds the symbols of the first argument to the
+/// values following it in the calling environment and evaluates
+/// the body (the last argument) there. If the body results in
+/// a `recur` the symbols are rebound and the body is evaluated
+/// again, otherwise its result is returned. The symbols are
+/// bound as before the loop once it ends.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_loop(lenv* e, lval* a);
+
+
+/// \brief Restarts the enclosing `loop` with new values.
+///
+/// \details Returns an error outside the body of a `loop`,
+/// including from a function called within one.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_recur(lenv* e, lval* a);
+
+
+/// \brief Evaluates a body while a condition is non-zero.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_while(lenv* e, lval* a);
+
+
+/// \brief Evaluates a body for each item of a sequence.
+///
+/// \details Binds the symbol to each item of a Q-Expression
+/// or sequence in turn in the calling environment, as `while`
+/// evaluates its body there, and evaluates the body each
+/// time. The symbol is bound as before the loop once it ends.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_for_each(lenv* e, lval* a);
+
+
+/// \brief Evaluates a body N times.
+///
+/// \details Binds the symbol to the numbers 0 up to N
+/// in turn in the calling environment and evaluates the body
+/// each time. The symbol is bound as before the loop once it ends.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_dotimes(lenv* e, lval* a);
+
+
 ////////////////////////////
 /// Builtin IO functions ///
 ////////////////////////////
 
-/// TODO
+/// \brief Loads and evaluates a source file.
+///
+/// \details Evaluates each form of the file named by the
+/// String argument in `e` as it is read, printing the errors
+/// forms evaluate to and carrying on. Returns an error if the
+/// file cannot be opened or a form cannot be parsed, in which
+/// case the forms before it have been evaluated and none after
+/// it are, otherwise returns an empty S-Expression.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
 lval* builtin_load(lenv* e, lval* a);
 
 
@@ -237,6 +946,29 @@ lval* builtin_load(lenv* e, lval* a);
 lval* builtin_print(lenv* e, lval* a);
 
 
+/// \brief Returns the printed form of a value.
+///
+/// \details Returns a String holding the value exactly
+/// as `print` would write it, with Strings quoted and
+/// escaped.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_show(lenv* e, lval* a);
+
+
+/// \brief Converts a value to a String.
+///
+/// \details Returns a String unchanged and the printed
+/// form of any other value.
+///
+/// \param e - type: lenv*
+/// \param a - type: lval*
+/// \return lval*
+lval* builtin_to_string(lenv* e, lval* a);
+
+
 /// TODO
 // lval* builtin_input(lenv* e, lval* a);
 
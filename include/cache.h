@@ -0,0 +1,169 @@
+#ifndef LIX_CACHE_H
+#define LIX_CACHE_H
+
+#include <lval.h>
+#include <types.h>
+
+#include <stdio.h>
+
+
+/// \brief Version of the cache entry format.
+///
+/// \details Bumped whenever the encoding of a cache
+/// entry changes so entries written by older interpreters
+/// are ignored.
+#define LCACHE_FORMAT 1
+
+
+/// \brief Most bytes of entries kept under `~/.lix/cache`.
+///
+/// \details Recording an entry removes the least recently
+/// written entries once the others take up more than this.
+#define LCACHE_MAX_SIZE (64L * 1024 * 1024)
+
+
+/// \brief Age in seconds after which an unfinished
+/// recording is taken to be abandoned.
+#define LCACHE_TMP_AGE 3600
+
+
+/// \brief Represents a cache entry holding the parsed
+/// forms of one source file.
+///
+/// Entries live under `~/.lix/cache`, named by a hash of
+/// the absolute path of their source. Each is keyed by that
+/// path, the size and modification time of the source and
+/// the interpreter version, and is ignored once any of
+/// them changes.
+///
+/// An entry is recorded into a temporary file beside it
+/// and renamed into place once complete, so readers never
+/// see a partial entry. Temporary files abandoned by runs
+/// that were killed, and the oldest entries once there are
+/// too many, are removed when the next entry is recorded. An entry being read is mapped into
+/// memory and decoded in place.
+///
+/// The same encoding is also read from and written to
+/// memory and streams, where it holds functions too, as
+/// for the prelude image.
+///
+/// A `lcache` consists of a:
+/// - file      : FILE* corresponding to the entry being recorded
+/// - data      : char* corresponding to the mapping of the entry being read
+/// - len       : long corresponding to the length of `data`
+/// - pos       : long corresponding to the read position in `data`
+/// - mapped    : int set if `data` is mapped rather than borrowed
+/// - env       : lenv* builtins are resolved against (or NULL)
+/// - path      : char* corresponding to the path (or name) of the entry
+/// - tmp       : char* corresponding to the file being recorded (or NULL)
+typedef struct lcache
+{
+    FILE* file;
+
+    char* data;
+    long len;
+    long pos;
+    int mapped;
+
+    lenv* env;
+
+    char* path;
+    char* tmp;
+} lcache;
+
+
+/////////////////////////////
+/// `lcache` Constructors ///
+/////////////////////////////
+
+/// \brief Opens the cache entry of the source `src`.
+///
+/// \details Returns the entry for the source file `src`
+/// positioned at its first form, or NULL if there is no
+/// entry or it is out of date.
+///
+/// \param src - type: char*
+/// \return lcache*
+lcache* lcache_open(char* src);
+
+
+/// \brief Starts recording a cache entry for `src`.
+///
+/// \details Returns a new entry for the regular file
+/// `src` to write its forms to, or NULL if it cannot be
+/// cached.
+///
+/// \param src - type: char*
+/// \return lcache*
+lcache* lcache_record(char* src);
+
+
+/// \brief Opens an entry held in memory.
+///
+/// \details Returns an entry named `name` reading the
+/// `len` bytes at `data`, which it borrows, or NULL if they
+/// do not end an entry. Builtins are resolved by name
+/// against `e`.
+///
+/// \param name - type: char*
+/// \param data - type: const char*
+/// \param len - type: long
+/// \param e - type: lenv*
+/// \return lcache*
+lcache* lcache_memory(char* name, const char* data, long len, lenv* e);
+
+
+/// \brief Starts writing an entry to a stream.
+///
+/// \details Returns an entry named `name` written to
+/// `f`, which is left open when the entry is closed.
+/// Builtins are written by the name they are bound to
+/// in `e`.
+///
+/// \param name - type: char*
+/// \param f - type: FILE*
+/// \param e - type: lenv*
+/// \return lcache*
+lcache* lcache_stream(char* name, FILE* f, lenv* e);
+
+
+/// \brief Closes the cache entry `c`.
+///
+/// \details Closes and frees `c`. An entry being recorded
+/// replaces any older entry if `commit` is set and is
+/// discarded otherwise.
+///
+/// \param c - type: lcache*
+/// \param commit - type: int
+void lcache_close(lcache* c, int commit);
+
+
+////////////////////////
+/// `lcache` Methods ///
+////////////////////////
+
+/// \brief Reads the next form out of the entry `c`.
+///
+/// \details Returns the next form of `c`, NULL once all
+/// of them are read or an lval of type LVAL_ERR if the
+/// entry is corrupt.
+///
+/// \param c - type: lcache*
+/// \return lval*
+lval* lcache_read(lcache* c);
+
+
+/// \brief Writes the form `v` to the entry `c`.
+///
+/// \details Appends `v` to the entry being recorded.
+/// Returns 0 if `v` cannot be encoded. Besides what the
+/// parser produces, only functions are, and builtins only
+/// when `c` has an environment to name them by.
+///
+/// \param c - type: lcache*
+/// \param v - type: lval*
+/// \return int
+int lcache_write(lcache* c, lval* v);
+
+
+#endif  /// LIX_CACHE_H
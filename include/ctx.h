@@ -0,0 +1,137 @@
+#ifndef LIX_CTX_H
+#define LIX_CTX_H
+
+#include <lval.h>
+#include <types.h>
+
+#include <stdio.h>
+
+
+/// \brief Default limit on nested function calls.
+///
+/// \details Zero leaves calls limited only by the stack
+/// of the thread making them.
+#define LCTX_MAX_DEPTH 0
+
+
+/// \brief Bytes of stack kept free below the deepest call.
+#define LCTX_STACK_MARGIN (1024 * 1024)
+
+
+///////////////////////////
+/// `lctx` Constructors ///
+///////////////////////////
+
+/// \brief Constructs a new interpreter instance.
+///
+/// \details Constructs a new interpreter instance with a
+/// global environment holding all the builtin functions,
+/// writing its output to stdout. The prelude is not loaded.
+///
+/// \return lctx*
+lctx* lctx_new(void);
+
+
+//////////////////////////
+/// `lctx` Destructors ///
+//////////////////////////
+
+/// \brief Destroys the interpreter instance `c`.
+///
+/// \details Destroys the interpreter instance `c`, its
+/// modules, its global environment and any definitions
+/// still waiting to be bound, stopping its worker
+/// pool and event loop (if started). Does not close its
+/// output.
+///
+/// \param c - type: lctx*
+void lctx_del(lctx* c);
+
+
+//////////////////////
+/// `lctx` Methods ///
+//////////////////////
+
+/// \brief Evaluates the source `s` in the instance `c`.
+///
+/// \details Reads and evaluates each expression of the
+/// source `s` in turn in the global environment of `c`.
+/// Returns the result of the last expression or the first error.
+///
+/// \param c - type: lctx*
+/// \param s - type: char*
+/// \return lval*
+lval* lctx_eval(lctx* c, char* s);
+
+
+/// \brief Sets up the context of a task run for `c`.
+///
+/// \details Sets up `task` to share the global environment,
+/// output and worker pool of `c` while counting nested
+/// calls on its own. Calls made by `task` are not profiled
+/// or traced.
+/// The lock of `task` is left untouched;
+/// the global environment is always guarded by the lock
+/// of the instance.
+///
+/// \param c - type: lctx*
+/// \param task - type: lctx*
+void lctx_fork(lctx* c, lctx* task);
+
+
+/// \brief Returns the worker pool of the instance `c`.
+///
+/// \details Returns the pool of the instance owning `c`,
+/// starting it with as many threads as its `workers` the
+/// first time it is needed.
+///
+/// \param c - type: lctx*
+/// \return lpool*
+lpool* lctx_pool(lctx* c);
+
+
+/// \brief Returns the event loop of the instance `c`.
+///
+/// \details Returns the event loop of the instance owning
+/// `c`, creating it on the calling thread the first time it
+/// is needed. Returns NULL if the platform has no event loop.
+///
+/// \param c - type: lctx*
+/// \return lloop*
+lloop* lctx_loop(lctx* c);
+
+
+/// \brief Sets the lowest address calls may reach on this thread.
+///
+/// \details Makes `floor` the lowest address the stack of
+/// the calling thread may grow to before calls fail, returning
+/// the previous one so it can be restored. The first floor of
+/// each thread is found from its stack, `LCTX_STACK_MARGIN`
+/// above its end, or is NULL if the platform cannot tell.
+///
+/// \param floor - type: char*
+/// \return char*
+char* lctx_stack_floor(char* floor);
+
+
+/// \brief Checks whether the stack of this thread is exhausted.
+///
+/// \details Returns 1 if the stack of the calling thread has
+/// grown past its floor (see `lctx_stack_floor`), otherwise
+/// returns 0. Stacks are assumed to grow downwards.
+///
+/// \return int
+int lctx_stack_low(void);
+
+
+/// \brief Returns where the environment `e` writes output.
+///
+/// \details Returns the output of the instance owning `e`
+/// or stdout if `e` does not belong to one.
+///
+/// \param e - type: lenv*
+/// \return FILE*
+FILE* lctx_out(lenv* e);
+
+
+#endif  /// LIX_CTX_H
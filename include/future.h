@@ -0,0 +1,95 @@
+#ifndef LIX_FUTURE_H
+#define LIX_FUTURE_H
+
+#include <lval.h>
+#include <pool.h>
+#include <types.h>
+
+
+/// \brief Represents the result of a spawned task
+///
+/// A `lfut` is shared between every lval that refers to
+/// it and the task computing it. `result` may only be read
+/// once `group` has no pending tasks.
+///
+/// A `lfut` consists of a:
+/// - refs      : atomic int corresponding to the number of owners
+/// - expr      : lval* corresponding to the S-Expression to evaluate (until run)
+/// - env       : lenv* corresponding to the snapshot `expr` is evaluated in (until run)
+/// - ctx       : lctx corresponding to the context of the task
+/// - group     : lpool_group the task is counted in
+/// - result    : lval* corresponding to the value of `expr` (once run)
+typedef struct lfut
+{
+    _Atomic int refs;
+
+    lval* expr;
+    lenv* env;
+    lctx ctx;
+
+    lpool_group group;
+    lval* result;
+} lfut;
+
+
+///////////////////////////
+/// `lfut` Constructors ///
+///////////////////////////
+
+/// \brief Spawns a task evaluating `expr`.
+///
+/// \details Queues the evaluation of the S-Expression
+/// `expr` in a snapshot of `e` on the worker pool of the
+/// instance owning `e`, returning the future of its result.
+/// Evaluates `expr` straight away if `e` does not belong to
+/// an instance. Takes ownership of `expr`.
+///
+/// \param e - type: lenv*
+/// \param expr - type: lval*
+/// \return lfut*
+lfut* lfut_spawn(lenv* e, lval* expr);
+
+
+/// \brief Adds a reference to the future `f`.
+///
+/// \param f - type: lfut*
+/// \return lfut*
+lfut* lfut_ref(lfut* f);
+
+
+/// \brief Drops a reference to the future `f`.
+///
+/// \details Drops a reference to the future `f`
+/// and frees it once the last reference is gone.
+///
+/// \param f - type: lfut*
+void lfut_unref(lfut* f);
+
+
+//////////////////////
+/// `lfut` Methods ///
+//////////////////////
+
+/// \brief Waits for the future `f` and returns its result.
+///
+/// \details Waits as lfut_await does but returns the result
+/// of `f` itself, which `f` keeps.
+///
+/// \param f - type: lfut*
+/// \return lval*
+lval* lfut_result(lfut* f);
+
+
+/// \brief Waits for the result of the future `f`.
+///
+/// \details Returns a copy of the result of `f`, running
+/// other queued tasks on the calling thread until it is
+/// ready so that awaiting from within a task cannot
+/// deadlock the pool.
+///
+/// \param f - type: lfut*
+/// \return lval*
+lval* lfut_await(lfut* f);
+
+
+#endif  /// LIX_FUTURE_H
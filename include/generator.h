@@ -0,0 +1,108 @@
+#ifndef LIX_GENERATOR_H
+#define LIX_GENERATOR_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Stack size of each generator.
+///
+/// \details Matches the stack of worker threads so code
+/// nests as deeply in a generator as anywhere else. Pages
+/// are only committed as the stack grows.
+#define LGEN_STACK_SIZE (8 * 1024 * 1024)
+
+
+/// \brief Error given by `generator` when lgen_new fails.
+///
+/// \details Generators switch stacks with ucontext, which
+/// Windows lacks, so there every lgen function fails.
+#ifdef _WIN32
+    #define LGEN_UNAVAILABLE "Function 'generator' is not supported on this platform."
+#else
+    #define LGEN_UNAVAILABLE "Function 'generator' could not allocate a stack."
+#endif  /// _WIN32
+
+
+///////////////////////////
+/// `lgen` Constructors ///
+///////////////////////////
+
+/// \brief Constructs a generator over `expr`.
+///
+/// \details Constructs a generator that evaluates the
+/// S-Expression `expr` in a snapshot of `e` on its own
+/// stack, pausing at every `yield`. Nothing is evaluated
+/// until the first call to lgen_next. Takes ownership of
+/// `expr`. `e` must belong to an interpreter instance.
+/// Returns NULL if the stack cannot be allocated (or on
+/// platforms without generators); see LGEN_UNAVAILABLE.
+///
+/// \param e - type: lenv*
+/// \param expr - type: lval*
+/// \return lgen*
+lgen* lgen_new(lenv* e, lval* expr);
+
+
+/// \brief Adds a reference to the generator `g`.
+///
+/// \param g - type: lgen*
+/// \return lgen*
+lgen* lgen_ref(lgen* g);
+
+
+/// \brief Drops a reference to the generator `g`.
+///
+/// \details Drops a reference to the generator `g` and
+/// frees it once the last reference is gone. A generator
+/// left paused is first resumed with every `yield` failing
+/// so its evaluation unwinds and frees what it holds.
+///
+/// \param g - type: lgen*
+void lgen_unref(lgen* g);
+
+
+//////////////////////
+/// `lgen` Methods ///
+//////////////////////
+
+/// \brief Resumes the generator `g` until its next value.
+///
+/// \details Runs `g` until it yields a value, which is
+/// returned, or finishes. Returns NULL once `g` has
+/// finished, or an error if its evaluation failed (once)
+/// or it is already running.
+///
+/// \param g - type: lgen*
+/// \return lval*
+lval* lgen_next(lgen* g);
+
+
+/// \brief Calls `f` on what the generator `g` holds.
+///
+/// \details Calls `f` with `data` on the expression of `g`
+/// if it has not started and on each binding of the snapshot
+/// it evaluates in. Values live only on its paused stack are
+/// not visited, and neither is anything of a generator
+/// running on another thread.
+///
+/// \param g - type: lgen*
+/// \param f - type: void (*)(lval*, void*)
+/// \param data - type: void*
+void lgen_each(lgen* g, void (*f)(lval*, void*), void* data);
+
+
+/// \brief Yields `v` from the generator running in `e`.
+///
+/// \details Pauses the generator running in `e`, handing
+/// `v` to the caller of lgen_next, and returns `()` once
+/// it is resumed. Returns an error (freeing `v`) outside of
+/// a generator or if the generator is being closed.
+///
+/// \param e - type: lenv*
+/// \param v - type: lval*
+/// \return lval*
+lval* lgen_yield(lenv* e, lval* v);
+
+
+#endif  /// LIX_GENERATOR_H
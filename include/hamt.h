@@ -0,0 +1,108 @@
+#ifndef LIX_HAMT_H
+#define LIX_HAMT_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Enum for the parts of entries lhamt_collect gathers
+///
+/// The possible parts are:
+/// - LHAMT_KEYS : The key of each entry
+/// - LHAMT_VALS : The value of each entry
+/// - LHAMT_PAIRS : A Q-Expression of the key and value of each entry
+enum { LHAMT_KEYS, LHAMT_VALS, LHAMT_PAIRS };
+
+
+////////////////////////////
+/// `lhamt` Constructors ///
+////////////////////////////
+
+/// \brief Adds a reference to the node `n`.
+///
+/// \param n - type: lhamt*
+/// \return lhamt*
+lhamt* lhamt_ref(lhamt* n);
+
+
+/// \brief Drops a reference to the node `n`.
+///
+/// \details Drops a reference to the node `n` and frees
+/// it, along with any children and entries no longer
+/// shared, once the last reference is gone. Accepts NULL
+/// (the empty trie).
+///
+/// \param n - type: lhamt*
+void lhamt_unref(lhamt* n);
+
+
+///////////////////////
+/// `lhamt` Methods ///
+///////////////////////
+
+/// \brief Finds the entry for the key `k` in the trie `n`.
+///
+/// \details Finds the entry for the key `k`, whose hash
+/// is `h`, in the trie rooted at `n`. Returns NULL if
+/// there is no such entry.
+///
+/// \param n - type: lhamt*
+/// \param k - type: lval*
+/// \param h - type: unsigned long
+/// \return lhent*
+lhent* lhamt_find(lhamt* n, lval* k, unsigned long h);
+
+
+/// \brief Returns a trie with the key `k` bound to `v`.
+///
+/// \details Returns a new trie holding every entry of `n`
+/// plus `k` bound to `v`, replacing any previous binding.
+/// `n` is left untouched and shares all unchanged nodes
+/// with the result. Takes ownership of `k` and `v` and sets
+/// `added` if `k` was not already present.
+///
+/// \param n - type: lhamt*
+/// \param k - type: lval*
+/// \param v - type: lval*
+/// \param h - type: unsigned long
+/// \param added - type: int*
+/// \return lhamt*
+lhamt* lhamt_insert(lhamt* n, lval* k, lval* v, unsigned long h, int* added);
+
+
+/// \brief Returns a trie without the key `k`.
+///
+/// \details Returns a new trie holding every entry of `n`
+/// except the one for `k`. `n` is left untouched and shares
+/// all unchanged nodes with the result. Sets `removed` if `k`
+/// was present. Returns NULL for the empty trie.
+///
+/// \param n - type: lhamt*
+/// \param k - type: lval*
+/// \param h - type: unsigned long
+/// \param removed - type: int*
+/// \return lhamt*
+lhamt* lhamt_remove(lhamt* n, lval* k, unsigned long h, int* removed);
+
+
+/// \brief Calls `fn` on every entry of the trie `n`.
+///
+/// \param n - type: lhamt*
+/// \param fn - type: void(*)(lhent*, void*)
+/// \param data - type: void*
+void lhamt_each(lhamt* n, void (*fn)(lhent*, void*), void* data);
+
+
+/// \brief Copies part of every entry of the trie `n` into a Q-Expression.
+///
+/// \details Copies the keys, values or key-value pairs
+/// (according to `part`) of every entry of the trie `n`
+/// into a new Q-Expression.
+///
+/// \param n - type: lhamt*
+/// \param part - type: int
+/// \return lval*
+lval* lhamt_collect(lhamt* n, int part);
+
+
+#endif  /// LIX_HAMT_H
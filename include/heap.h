@@ -0,0 +1,114 @@
+#ifndef LIX_HEAP_H
+#define LIX_HEAP_H
+
+#include <lval.h>
+#include <types.h>
+
+#include <stdio.h>
+
+
+/// \brief Number of lval types counted.
+#define LHEAP_TYPES (LVAL_MOD + 1)
+
+
+/// \brief Represents a snapshot of the heap counters
+///
+/// The counters are only kept by builds defining
+/// LIX_HEAP_STATS (as debug builds do); otherwise the
+/// hooks below compile to nothing.
+///
+/// A `lheap_stats` consists of a:
+/// - live      : long[] corresponding to the lvals alive of each type
+/// - total     : long corresponding to the lvals alive of any type
+/// - peak      : long corresponding to the most lvals alive at once
+/// - allocated : long corresponding to the lvals allocated
+/// - freed     : long corresponding to the lvals freed
+/// - copies    : long corresponding to the lvals duplicated by lval_copy
+/// - copied    : long corresponding to the bytes duplicated by lval_copy
+/// - envs      : long corresponding to the calls to lenv_copy
+/// - bindings  : long corresponding to the bindings duplicated by lenv_copy
+/// - rss       : long corresponding to the peak resident size of the process in kilobytes
+typedef struct lheap_stats
+{
+    long live[LHEAP_TYPES];
+    long total;
+    long peak;
+
+    long allocated;
+    long freed;
+
+    long copies;
+    long copied;
+
+    long envs;
+    long bindings;
+
+    long rss;
+} lheap_stats;
+
+
+#ifdef LIX_HEAP_STATS
+    #define LHEAP_ALLOC(t) lheap_alloc(t)
+    #define LHEAP_FREE(t) lheap_free(t)
+    #define LHEAP_RETYPE(v, t) (lheap_free((v)->type), lheap_alloc(t), (v)->type = (t))
+    #define LHEAP_COPIED(v) lheap_copied(v)
+    #define LHEAP_ENV_COPIED(e) lheap_env_copied(e)
+#else
+    #define LHEAP_ALLOC(t) ((void)0)
+    #define LHEAP_FREE(t) ((void)0)
+    #define LHEAP_RETYPE(v, t) ((v)->type = (t))
+    #define LHEAP_COPIED(v) ((void)0)
+    #define LHEAP_ENV_COPIED(e) ((void)0)
+#endif  /// LIX_HEAP_STATS
+
+
+/////////////////////
+/// Heap Counters ///
+/////////////////////
+
+/// \brief Counts an lval of type `t` allocated.
+///
+/// \param t - type: int
+void lheap_alloc(int t);
+
+
+/// \brief Counts an lval of type `t` freed.
+///
+/// \param t - type: int
+void lheap_free(int t);
+
+
+/// \brief Counts `v` as duplicated by lval_copy.
+///
+/// \details Counts the bytes of `v` itself and of the
+/// strings and cell array it owns; its children are
+/// counted by their own copies.
+///
+/// \param v - type: lval*
+void lheap_copied(lval* v);
+
+
+/// \brief Counts `e` as duplicated by lenv_copy.
+///
+/// \param e - type: lenv*
+void lheap_env_copied(lenv* e);
+
+
+/// \brief Reads the heap counters.
+///
+/// \details Stores the counters of every instance in the
+/// process into `s`. Returns 0 (leaving `s` untouched) if
+/// the build does not keep them.
+///
+/// \param s - type: lheap_stats*
+/// \return int
+int lheap_snapshot(lheap_stats* s);
+
+
+/// \brief Writes a summary of the heap counters to `out`.
+///
+/// \param out - type: FILE*
+void lheap_report(FILE* out);
+
+
+#endif  /// LIX_HEAP_H
@@ -0,0 +1,65 @@
+#ifndef LIX_IMAGE_H
+#define LIX_IMAGE_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Version of the prelude image format.
+///
+/// \details Bumped whenever the layout of an image changes
+/// so that an out of date image is never restored.
+#define LIMAGE_FORMAT 1
+
+
+/// \brief The prelude image linked into the interpreter.
+///
+/// \details The global bindings left by evaluating
+/// `stdlib/prelude.lx`, encoded as a cache entry. The first
+/// form is a Q-Expression of the image format, interpreter
+/// version and the prelude source it was built from; every
+/// form after it is a `{symbol value}` binding. The image
+/// holds no pointers, so it is used straight out of the
+/// executable's read-only data.
+///
+/// It is generated into `src/lib/prelude.image.c` by
+/// `create-image.sh` and has to be regenerated whenever
+/// the prelude changes.
+extern const unsigned char limage_prelude[];
+
+
+/// \brief Length of `limage_prelude` in bytes.
+extern const long limage_prelude_len;
+
+
+/// \brief Restores the prelude image into `e`.
+///
+/// \details Binds the globals of the prelude image in `e`
+/// without reading or evaluating the prelude. The image is
+/// only used if it was built by this interpreter and the
+/// prelude at `src` (if it exists) is the one it was built
+/// from, so an edited prelude on disk overrides it. Returns
+/// NULL, binding nothing, if the image cannot stand in for
+/// `src` or cannot be decoded.
+///
+/// \param e - type: lenv*
+/// \param src - type: char*
+/// \return lval*
+lval* limage_restore(lenv* e, char* src);
+
+
+/// \brief Builds a prelude image.
+///
+/// \details Evaluates the prelude at `src` in `e`, which
+/// should hold nothing but the builtins, and writes the
+/// resulting globals out as a C source file at `out`
+/// defining `limage_prelude`.
+///
+/// \param e - type: lenv*
+/// \param src - type: char*
+/// \param out - type: char*
+/// \return lval*
+lval* limage_build(lenv* e, char* src, char* out);
+
+
+#endif  /// LIX_IMAGE_H
@@ -3,17 +3,139 @@
 
 
 #include <lval.h>
+#include <writer.h>
+
+#include <stdio.h>
 
 
 //////////////////////
 /// `lval` Reading ///
 //////////////////////
 
+/// \brief A source file read one form at a time.
+///
+/// Regular files are mapped straight into memory so the
+/// parser reads them without a copy. Anything else (pipes,
+/// terminals, files that cannot be mapped) is read through
+/// `stream`, buffering a single top-level form at a time.
+/// Either way `data` is followed by a null terminator.
+///
+/// A mapped source can be parsed ahead in parallel, a
+/// window of forms at a time, which are then handed out
+/// in order from `ahead`.
+///
+/// A source with an up to date cache entry is not read at
+/// all; its forms come straight from `cache`. Otherwise the
+/// forms parsed are recorded into a new entry.
+///
+/// A `lsrc` consists of a:
+/// - data      : char* corresponding to the contents or the buffered form
+/// - len       : long corresponding to the length of a mapping or buffer
+/// - pos       : int corresponding to the read position in `data`
+/// - mapped    : int set if `data` is mapped rather than allocated
+/// - stream    : FILE* corresponding to the file read when not mapped
+/// - pool      : lpool* parsing ahead (or NULL to parse form by form)
+/// - workers   : int corresponding to the number of chunks parsed at once
+/// - ahead     : lval* corresponding to the forms parsed ahead
+/// - taken     : int corresponding to the forms of `ahead` handed out
+/// - cache     : lcache* the forms are read from (or NULL)
+/// - record    : lcache* the parsed forms are recorded into (or NULL)
+typedef struct lsrc
+{
+    char* data;
+    long len;
+    int pos;
+    int mapped;
+
+    FILE* stream;
+
+    lpool* pool;
+    int workers;
+    lval* ahead;
+    int taken;
+
+    struct lcache* cache;
+    struct lcache* record;
+} lsrc;
+
+
+/// \brief Opens the source file at `path`.
+///
+/// \details Opens the cache entry of the file at `path`
+/// if it is up to date. Otherwise maps the file into memory,
+/// falling back to reading it as a stream when it cannot be
+/// mapped with a null terminator. Returns NULL if it cannot
+/// be opened.
+///
+/// \param path - type: char*
+/// \return lsrc*
+lsrc* lsrc_open(char* path);
+
+
+/// \brief Parses the source `s` ahead on the pool of `c`.
+///
+/// \details Has the forms of a mapped source parsed
+/// ahead of time on the `workers` threads of the pool of `c`,
+/// starting the pool if needed. The forms are still returned
+/// by lsrc_next in order, one at a time. Streams and small
+/// sources keep parsing form by form and leave the pool unstarted.
+///
+/// \param s - type: lsrc*
+/// \param c - type: lctx*
+void lsrc_parallel(lsrc* s, lctx* c);
+
+
+/// \brief Reads the next top-level form out of `s`.
+///
+/// \details Returns the next form of `s` as an lval,
+/// NULL once `s` is exhausted or an lval of type LVAL_ERR
+/// if the form cannot be parsed. Nothing but the returned
+/// form is held in memory, so a caller evaluating and
+/// freeing each form in turn runs in space bounded by the
+/// largest form.
+///
+/// \param s - type: lsrc*
+/// \return lval*
+lval* lsrc_next(lsrc* s);
+
+
+/// \brief Releases the source file `s`.
+///
+/// \param s - type: lsrc*
+void lsrc_close(lsrc* s);
+
 
 ///////////////////////
 /// `lval` Printing ///
 ///////////////////////
 
+/// \brief Writes the lval to the writer `w`.
+///
+/// \details Writes the printed form of the lval to
+/// `w`. Every other printing function goes through it.
+///
+/// \param w - type: lwriter*
+/// \param v - type: lval*
+void lval_write(lwriter* w, lval* v);
+
+
+/// \brief Prints the lval to `out`.
+///
+/// \details Prints the lval to `out` through a writer,
+/// so it reaches `out` in bulk.
+///
+/// \param out - type: FILE*
+/// \param v - type: lval* 
+void lval_fprint(FILE* out, lval* v);
+
+
+/// \brief Prints the lval to `out` with a newline.
+///
+/// \param out - type: FILE*
+/// \param v - type: lval*
+void lval_fprintln(FILE* out, lval* v);
+
+
 /// \brief Prints the lval
 ///
 /// \details Prints the lval to stdout.
@@ -28,27 +150,53 @@ void lval_print(lval* v);
 void lval_println(lval* v);
 
 
+/// \brief Returns the printed form of the lval.
+///
+/// \details Returns the lval as it would be printed in
+/// a new string, which the caller frees.
+///
+/// \param v - type: lval*
+/// \return char*
+char* lval_show(lval* v);
+
+
 ///////////////////////////
 /// Expression Printing ///
 ///////////////////////////
 
-/// \brief Prints the lval as an expression to stdout.
+/// \brief Prints the lval as an expression to `w`.
 ///
 /// \details Prints the lval as an expression surrounded
 /// by the `open` and `close` parameters.
 ///
+/// \param w - type: lwriter*
 /// \param v - type: lval*
 /// \param open - type: char
 /// \param close - type: char
-void lval_expr_print(lval* v, char open, char close);
+void lval_expr_print(lwriter* w, lval* v, char open, char close);
+
+
+/// \brief Prints the entries of a Hash-Map or Hash-Set to `w`.
+///
+/// \details Prints the keys or key-value pairs (according
+/// to `part`) of the Hash-Map or Hash-Set `v` surrounded by
+/// braces.
+///
+/// \param w - type: lwriter*
+/// \param v - type: lval*
+/// \param part - type: int
+void lval_hamt_print(lwriter* w, lval* v, int part);
 
 
 /////////////////
 /// String IO ///
 /////////////////
 
-/// TODO
-void lval_print_str(lval* v);
+/// \brief Prints the String `v` to `w` with its escapes.
+///
+/// \param w - type: lwriter*
+/// \param v - type: lval*
+void lval_print_str(lwriter* w, lval* v);
 
 
 
@@ -0,0 +1,83 @@
+#ifndef LIX_LAZY_H
+#define LIX_LAZY_H
+
+#include <lval.h>
+#include <types.h>
+
+#include <pthread.h>
+
+
+/// \brief Represents a source whose definitions are bound
+/// on first use.
+///
+/// Each top-level `(fun {name ...} ...)` and `(def {name} ...)`
+/// form of the source is indexed by `name` without being
+/// parsed. The form is only parsed and evaluated once `name`
+/// is looked up and found unbound, so loading the source
+/// costs a scan of its text.
+///
+/// Definitions are bound by whichever thread first misses
+/// them. `lock` is recursive so that binding one definition
+/// may bind the others it uses.
+///
+/// A `llazy` consists of a:
+/// - data      : char* corresponding to the text of the source
+/// - count     : int corresponding to the number of indexed forms
+/// - syms      : char** corresponding to the name each form defines
+/// - starts    : int* corresponding to where each form starts in `data` (-1 once bound)
+/// - lock      : pthread_mutex_t guarding the index
+typedef struct llazy
+{
+    char* data;
+
+    int count;
+    char** syms;
+    int* starts;
+
+    pthread_mutex_t lock;
+} llazy;
+
+
+////////////////////////////
+/// `llazy` Constructors ///
+////////////////////////////
+
+/// \brief Loads the source at `path` lazily into `e`.
+///
+/// \details Indexes the definitions of the source file at
+/// `path` on the instance owning the global environment `e`
+/// and evaluates its other top-level forms straight away.
+/// Loads `path` as builtin_load does if `e` does not belong
+/// to an instance or the instance already has a source
+/// loaded lazily.
+///
+/// \param e - type: lenv*
+/// \param path - type: char*
+/// \return lval*
+lval* llazy_load(lenv* e, char* path);
+
+
+/// \brief Frees the index `l`.
+///
+/// \param l - type: llazy*
+void llazy_del(llazy* l);
+
+
+///////////////////////
+/// `llazy` Methods ///
+///////////////////////
+
+/// \brief Binds the definitions of `name` not yet bound.
+///
+/// \details Evaluates every indexed form defining `name`
+/// not evaluated yet in the instance owning `e`, waiting
+/// for any other thread binding them. Returns 0 if no
+/// indexed form defines `name`.
+///
+/// \param e - type: lenv*
+/// \param name - type: char*
+/// \return int
+int llazy_resolve(lenv* e, char* name);
+
+
+#endif  /// LIX_LAZY_H
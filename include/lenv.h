@@ -8,6 +8,14 @@
 #include <stdlib.h>
 
 
+/// \brief Bindings an environment holds before lookups
+/// in it go through a hash table.
+///
+/// \details Function frames stay below it and are
+/// scanned; global environments are indexed.
+#define LENV_INDEX_MIN 32
+
+
 ///////////////////////////
 /// `lenv` Constructors ///
 ///////////////////////////
@@ -20,6 +28,17 @@
 lenv* lenv_new(void);
 
 
+/// \brief Constructs a new lenv enclosed by `par`.
+///
+/// \details Constructs a new lenv whose lookups fall
+/// back to `par` and which belongs to the same 
+/// interpreter instance as `par`.
+///
+/// \param par - type: lenv*
+/// \return lenv*
+lenv* lenv_child(lenv* par);
+
+
 //////////////////////////
 /// `lenv` Destructors ///
 //////////////////////////
@@ -41,7 +60,11 @@ void lenv_del(lenv* e);
 /// 
 /// \details Returns a copy of the lval 
 /// `k` from the lenv `e` if it exists 
-/// otherwise returns an error.
+/// otherwise returns an error. A symbol that
+/// is not bound but has a lazily loaded definition
+/// is bound first. A qualified symbol such as
+/// `ns/name` that is not bound itself is looked
+/// up in the Module `ns`.
 ///
 /// \param e - type: lenv*
 /// \param k - type: lval*
@@ -49,6 +72,18 @@ void lenv_del(lenv* e);
 lval* lenv_get(lenv* e, lval* k);
 
 
+/// \brief Gets an lval bound in `e` itself.
+///
+/// \details Returns a copy of the value bound to `k` in
+/// `e`, without looking in its enclosing environments, or
+/// NULL if `e` does not bind `k`.
+///
+/// \param e - type: lenv*
+/// \param k - type: lval*
+/// \return lval*
+lval* lenv_local(lenv* e, lval* k);
+
+
 /// TODO
 lenv* lenv_copy(lenv* e);
 
@@ -65,6 +100,30 @@ lenv* lenv_copy(lenv* e);
 void lenv_put(lenv* e, lval* k, lval* v);
 
 
+/// \brief Removes the binding of `k` from `e`.
+///
+/// \details Removes the binding of `k` from `e` itself,
+/// not its enclosing environments, returning its value or
+/// NULL if `e` does not bind `k`.
+///
+/// \param e - type: lenv*
+/// \param k - type: lval*
+/// \return lval*
+lval* lenv_take(lenv* e, lval* k);
+
+
+/// \brief Takes a snapshot of the local scopes of `e`.
+///
+/// \details Returns a new environment holding a copy of
+/// every binding visible from `e` except the globals, whose
+/// parent is the global environment of `e`. `def` binds in
+/// the snapshot rather than in the global environment.
+///
+/// \param e - type: lenv*
+/// \return lenv*
+lenv* lenv_snapshot(lenv* e);
+
+
 /// TODO
 void lenv_def(lenv* e, lval* k, lval* v);
 
@@ -1,11 +1,32 @@
 #ifndef LIX_H
 #define LIX_H
 
+#include <actor.h>
+#include <array.h>
 #include <builtins.h>
+#include <cache.h>
+#include <ctx.h>
+#include <future.h>
+#include <generator.h>
+#include <hamt.h>
+#include <heap.h>
+#include <image.h>
 #include <io.h>
+#include <lazy.h>
+#include <loop.h>
 #include <lval.h>
 #include <lenv.h>
 #include <macros.h>
+#include <module.h>
+#include <parallel.h>
 #include <parser.h>
+#include <pool.h>
+#include <prefork.h>
+#include <profile.h>
+#include <seq.h>
+#include <serve.h>
+#include <sort.h>
+#include <trace.h>
+#include <writer.h>
 
 #endif  /// LIX_H
@@ -0,0 +1,168 @@
+#ifndef LIX_LOOP_H
+#define LIX_LOOP_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Maximum bytes handed to a read callback at once.
+#define LLOOP_CHUNK 65536
+
+
+/// \brief Maximum events taken from the kernel per wait.
+#define LLOOP_EVENTS 64
+
+
+////////////////////////////
+/// `lloop` Constructors ///
+////////////////////////////
+
+/// \brief Constructs an event loop.
+///
+/// \details Constructs an event loop bound to the calling
+/// thread. Returns NULL on platforms without epoll.
+///
+/// \return lloop*
+lloop* lloop_new(void);
+
+
+/// \brief Destroys the event loop `l`.
+///
+/// \details Closes every descriptor opened through `l`
+/// and frees any callbacks still registered.
+///
+/// \param l - type: lloop*
+void lloop_del(lloop* l);
+
+
+///////////////////////////
+/// `lloop` Descriptors ///
+///////////////////////////
+
+/// \brief Opens the file at `path` for non-blocking use.
+///
+/// \details Opens `path`, which may also be a named pipe,
+/// for reading ("r"), writing ("w") or appending ("a").
+/// Returns its descriptor or an error.
+///
+/// \param l - type: lloop*
+/// \param path - type: char*
+/// \param mode - type: char*
+/// \return lval*
+lval* lloop_open(lloop* l, char* path, char* mode);
+
+
+/// \brief Listens on the Unix-domain socket at `path`.
+///
+/// \details Replaces any socket file already at `path`.
+/// Returns the descriptor of the listening socket or an
+/// error.
+///
+/// \param l - type: lloop*
+/// \param path - type: char*
+/// \return lval*
+lval* lloop_listen(lloop* l, char* path);
+
+
+/// \brief Connects to the Unix-domain socket at `path`.
+///
+/// \details Returns the descriptor of the connection or
+/// an error.
+///
+/// \param l - type: lloop*
+/// \param path - type: char*
+/// \return lval*
+lval* lloop_connect(lloop* l, char* path);
+
+
+/// \brief Closes the descriptor `fd`.
+///
+/// \details Closes `fd` and drops its callbacks. Writes
+/// still queued on it are discarded.
+///
+/// \param l - type: lloop*
+/// \param fd - type: int
+/// \return lval*
+lval* lloop_close(lloop* l, int fd);
+
+
+///////////////////////
+/// `lloop` Methods ///
+///////////////////////
+
+/// \brief Calls `f` with whatever arrives on `fd`.
+///
+/// \details Calls `f` with each chunk read from `fd` as a
+/// String, and once with an empty String at end of file,
+/// after which `f` is dropped. Replaces any reader already
+/// set. Takes ownership of `f`.
+///
+/// \param l - type: lloop*
+/// \param fd - type: int
+/// \param f - type: lval*
+/// \return lval*
+lval* lloop_read(lloop* l, int fd, lval* f);
+
+
+/// \brief Calls `f` with each connection made to `fd`.
+///
+/// \details Calls `f` with the descriptor of every
+/// connection accepted on the listening socket `fd`.
+/// Takes ownership of `f`.
+///
+/// \param l - type: lloop*
+/// \param fd - type: int
+/// \param f - type: lval*
+/// \return lval*
+lval* lloop_accept(lloop* l, int fd, lval* f);
+
+
+/// \brief Writes the String `s` to `fd`.
+///
+/// \details Queues a copy of `s` to be written as `fd`
+/// drains while the loop runs. Once all of it is written
+/// `f` (if not NULL) is called with the number of bytes.
+/// Takes ownership of `f`.
+///
+/// \param l - type: lloop*
+/// \param fd - type: int
+/// \param s - type: char*
+/// \param f - type: lval*
+/// \return lval*
+lval* lloop_write(lloop* l, int fd, char* s, lval* f);
+
+
+/// \brief Calls `f` after `ms` milliseconds.
+///
+/// \details Calls `f` with no arguments once `ms`
+/// milliseconds have passed. Takes ownership of `f`.
+///
+/// \param l - type: lloop*
+/// \param ms - type: long
+/// \param f - type: lval*
+void lloop_timer(lloop* l, long ms, lval* f);
+
+
+/// \brief Runs the event loop `l`.
+///
+/// \details Waits for descriptors and timers and calls
+/// their callbacks in `e` until nothing is left to wait
+/// for or (if `ms` is not negative) `ms` milliseconds have
+/// passed. Returns the number of callbacks run or the first
+/// error a callback returns.
+///
+/// \param l - type: lloop*
+/// \param e - type: lenv*
+/// \param ms - type: long
+/// \return lval*
+lval* lloop_run(lloop* l, lenv* e, long ms);
+
+
+/// \brief Returns whether `l` may be used by the calling thread.
+///
+/// \param l - type: lloop*
+/// \return int
+int lloop_owned(lloop* l);
+
+
+#endif  /// LIX_LOOP_H
@@ -46,6 +46,30 @@ lval* lval_sym(char* s);
 lval* lval_str(char* s);
 
 
+/// \brief Creates an lval of type LVAL_SYM from a span.
+///
+/// \details Creates an lval of type LVAL_SYM from the
+/// first `n` characters of `s`, which need not be null
+/// terminated.
+///
+/// \param s - type: char*
+/// \param n - type: int
+/// \return lval*
+lval* lval_sym_n(char* s, int n);
+
+
+/// \brief Creates an lval of type LVAL_STR from a span.
+///
+/// \details Creates an lval of type LVAL_STR from the
+/// first `n` characters of `s`, which need not be null
+/// terminated.
+///
+/// \param s - type: char*
+/// \param n - type: int
+/// \return lval*
+lval* lval_str_n(char* s, int n);
+
+
 /// \brief Creates an lval of type LVAL_SEXPR.
 ///
 /// \details Creates an lval of type LVAL_SEXPR
@@ -85,6 +109,91 @@ lval* lval_fun(lbuiltin func);
 lval* lval_lambda(lval* formals, lval* body);
 
 
+/// \brief Constructs an lval of type LVAL_SEQ.
+///
+/// \details Constructs an lval of type LVAL_SEQ
+/// that takes ownership of the reference to `s`.
+///
+/// \param s - type: lseq*
+/// \return lval*
+lval* lval_seq(lseq* s);
+
+
+/// \brief Constructs an lval of type LVAL_ARR.
+///
+/// \details Constructs an lval of type LVAL_ARR
+/// that takes ownership of the reference to `a`.
+///
+/// \param a - type: larr*
+/// \return lval*
+lval* lval_arr(larr* a);
+
+
+/// \brief Constructs an lval of type LVAL_FUT.
+///
+/// \details Constructs an lval of type LVAL_FUT
+/// that takes ownership of the reference to `f`.
+///
+/// \param f - type: lfut*
+/// \return lval*
+lval* lval_fut(lfut* f);
+
+
+/// \brief Constructs an lval of type LVAL_ACTOR.
+///
+/// \details Constructs an lval of type LVAL_ACTOR
+/// that takes ownership of the reference to `a`.
+///
+/// \param a - type: lactor*
+/// \return lval*
+lval* lval_actor(lactor* a);
+
+
+/// \brief Constructs an lval of type LVAL_GEN.
+///
+/// \details Constructs an lval of type LVAL_GEN
+/// that takes ownership of the reference to `g`.
+///
+/// \param g - type: lgen*
+/// \return lval*
+lval* lval_gen(lgen* g);
+
+
+/// \brief Constructs an lval of type LVAL_MOD.
+///
+/// \details Constructs an lval of type LVAL_MOD
+/// referring to the module `m`, which stays owned by
+/// the instance that loaded it.
+///
+/// \param m - type: lmod*
+/// \return lval*
+lval* lval_mod(lmod* m);
+
+
+/// \brief Constructs an lval of type LVAL_MAP.
+///
+/// \details Constructs an lval of type LVAL_MAP holding
+/// `count` entries that takes ownership of the reference
+/// to the trie `root` (NULL for an empty map).
+///
+/// \param root - type: lhamt*
+/// \param count - type: int
+/// \return lval*
+lval* lval_map(lhamt* root, int count);
+
+
+/// \brief Constructs an lval of type LVAL_SET.
+///
+/// \details Constructs an lval of type LVAL_SET holding
+/// `count` items that takes ownership of the reference
+/// to the trie `root` (NULL for an empty set).
+///
+/// \param root - type: lhamt*
+/// \param count - type: int
+/// \return lval*
+lval* lval_set(lhamt* root, int count);
+
+
 /////////////////////////
 /// `lval` Destructor ///
 /////////////////////////
@@ -124,6 +233,18 @@ lval* lval_add(lval* v, lval* x);
 lval* lval_copy(lval* v);
 
 
+/// \brief Names the lambda `v` after `name`.
+///
+/// \details Records `name` as the name of `v` if `v` is a
+/// lambda without one, so a lambda keeps the name it was
+/// first defined under when copied or bound again. Other
+/// values are left untouched.
+///
+/// \param v - type: lval*
+/// \param name - type: char*
+void lval_name(lval* v, char* name);
+
+
 /// \brief Pops the ith element off of the lval `v`.
 ///
 /// \details Pops the ith element off of the lval `v`
@@ -163,6 +284,20 @@ lval* lval_eval(lenv* e, lval* v);
 lval* lval_call(lenv* e, lval* f, lval* a);
 
 
+/// \brief Calls the function `f` with the arguments `a`.
+///
+/// \details Calls the function `f` with the arguments `a`
+/// without consuming `f`, which lval_call would otherwise
+/// bind into. Consumes `a`. Returns an error if `f` is 
+/// not of type LVAL_FUN.
+///
+/// \param e - type: lenv*
+/// \param f - type: lval*
+/// \param a - type: lval*
+/// \return lval*
+lval* lval_apply(lenv* e, lval* f, lval* a);
+
+
 /// \brief Evaluates the lval `v` as an S-Expression.
 ///
 /// \details Evaluates the lval `v` as an S-Expression.
@@ -176,6 +311,32 @@ lval* lval_call(lenv* e, lval* f, lval* a);
 lval* lval_eval_sexpr(lenv* e, lval* v);
 
 
+/// \brief Evaluates the lval `v` without consuming it.
+///
+/// \details Evaluates the lval `v` the same way as
+/// lval_eval but leaves `v` untouched, so a body can be
+/// evaluated repeatedly without copying its S-Expressions
+/// and symbols first.
+///
+/// \param e - type: lenv*
+/// \param v - type: lval*
+/// \return lval*
+lval* lval_eval_ref(lenv* e, lval* v);
+
+
+/// \brief Calls an S-Expression whose children are evaluated.
+///
+/// \details Returns the first error among the children of `v`
+/// if there is one, otherwise calls the first child with the rest.
+/// Returns `v` as-is if it has no children or returns the
+/// child if it only has one child.
+///
+/// \param e - type: lenv*
+/// \param v - type: lval*
+/// \return lval*
+lval* lval_eval_cells(lenv* e, lval* v);
+
+
 /// \brief Joins the Q-Expression `y` to `x`.
 ///
 /// \details Joins the Q-Expression `y` to `x` 
@@ -192,11 +353,47 @@ lval* lval_join(lval* x, lval* y);
 int lval_eq(lval* x, lval* y);
 
 
+/// \brief Compares the lvals `x` and `y`.
+///
+/// \details Compares the lvals `x` and `y` under a total
+/// order, returning a negative number, zero or a positive
+/// number if `x` sorts before, with or after `y`. Numbers
+/// compare by value, Strings, Symbols and Errors by their
+/// text and lists and Arrays element by element. Values of
+/// different types are ordered by type.
+///
+/// \param x - type: lval*
+/// \param y - type: lval*
+/// \return int
+int lval_cmp(lval* x, lval* y);
+
+
+/// \brief Computes the structural hash of the lval `v`.
+///
+/// \details Computes a hash of the lval `v` from its type
+/// and contents such that lvals which are lval_eq hash the
+/// same.
+///
+/// \param v - type: lval*
+/// \return unsigned long
+unsigned long lval_hash(lval* v);
+
+
 ////////////////////
 /// Prelude Load ///
 ////////////////////
 
-/// TODO
+/// \brief Loads the prelude into the environment `e`.
+///
+/// \details Restores the prelude image linked into the
+/// interpreter into the environment `e`, unless
+/// `~/.lix/stdlib/prelude.lx` differs from the prelude it
+/// was built from, in which case that file is loaded
+/// lazily instead. Returns an error if neither can be used,
+/// otherwise the result of restoring or loading it.
+///
+/// \param e - type: lenv*
+/// \return lval*
 lval* load_prelude(lenv* e);
 
 #endif  /// LIX_LVAL_H
@@ -28,6 +28,20 @@
     func, args->count, num)
 
 
+#define LASSERT_SEQ(func, args, index)                                      \
+  LASSERT(args, args->cell[index]->type == LVAL_QEXPR                       \
+             || args->cell[index]->type == LVAL_SEQ                         \
+             || args->cell[index]->type == LVAL_ARR                         \
+             || args->cell[index]->type == LVAL_MAP                         \
+             || args->cell[index]->type == LVAL_SET                         \
+             || args->cell[index]->type == LVAL_GEN,                        \
+    "Function '%s' passed incorrect type for argument %i. "                 \
+    "Got %s, Expected a sequence (%s, %s, %s, %s, %s or %s).",              \
+    func, index, ltype_name(args->cell[index]->type),                       \
+    ltype_name(LVAL_QEXPR), ltype_name(LVAL_SEQ), ltype_name(LVAL_ARR),     \
+    ltype_name(LVAL_MAP), ltype_name(LVAL_SET), ltype_name(LVAL_GEN))
+
+
 #define LASSERT_NOT_EMPTY(func, args, index)                                \
   LASSERT(args, args->cell[index]->count != 0,                              \
     "Function '%s' passed {} for argument %i.", func, index);
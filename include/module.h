@@ -0,0 +1,113 @@
+#ifndef LIX_MODULE_H
+#define LIX_MODULE_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Represents a module loaded into an instance.
+///
+/// A module is the file at `path` evaluated once in its
+/// own environment, a child of the global environment in
+/// which `def` binds. Modules are kept by the instance that
+/// loaded them until it is freed and are shared by every
+/// lval referring to them.
+///
+/// A `lmod` consists of a:
+/// - path      : char* corresponding to the absolute path of the file
+/// - env       : lenv* corresponding to the namespace of the module
+/// - exports   : lval* corresponding to a Q-Expression of exported symbols (or NULL for all)
+/// - loading   : int corresponding to whether the file is still being evaluated
+/// - shared    : int corresponding to whether it was required again while loading
+/// - next      : lmod* corresponding to the next module of the instance
+typedef struct lmod
+{
+    char* path;
+    lenv* env;
+    lval* exports;
+
+    int loading;
+    int shared;
+
+    struct lmod* next;
+} lmod;
+
+
+///////////////////////////
+/// `lmod` Constructors ///
+///////////////////////////
+
+/// \brief Loads the module at `path` into the instance owning `e`.
+///
+/// \details Returns the module of the file at `path`,
+/// evaluating the file in a new namespace the first time it
+/// is required and returning the same module afterwards. A
+/// module required again while it is still loading (by a
+/// cycle of requires) is returned as it stands. Sets `err`
+/// and returns NULL if the file cannot be loaded or parsed,
+/// forgetting the module so a later require tries again.
+///
+/// \param e - type: lenv*
+/// \param path - type: char*
+/// \param err - type: lval**
+/// \return lmod*
+lmod* lmod_require(lenv* e, char* path, lval** err);
+
+
+/// \brief Frees the module `m`.
+///
+/// \details Frees the namespace, exports and path of `m`,
+/// which must no longer be linked into its instance.
+///
+/// \param m - type: lmod*
+void lmod_del(lmod* m);
+
+
+/// \brief Frees every module of the instance `c`.
+///
+/// \param c - type: lctx*
+void lmod_del_all(lctx* c);
+
+
+//////////////////////
+/// `lmod` Methods ///
+//////////////////////
+
+/// \brief Returns the module whose namespace encloses `e`.
+///
+/// \details Returns the module being evaluated in `e` or
+/// one of its enclosing environments, or NULL if `e` is
+/// not within a module.
+///
+/// \param e - type: lenv*
+/// \return lmod*
+lmod* lmod_of(lenv* e);
+
+
+/// \brief Looks an exported symbol up in the module `m`.
+///
+/// \details Returns a copy of the value bound to `name`
+/// in the namespace of `m` if `m` exports it, or an error.
+/// Functions looked up this way evaluate in the namespace of
+/// `m` wherever they are called, so they still see its
+/// private definitions.
+///
+/// \param m - type: lmod*
+/// \param name - type: char*
+/// \return lval*
+lval* lmod_get(lmod* m, char* name);
+
+
+/// \brief Resolves a qualified symbol such as `ns/name`.
+///
+/// \details Looks `ns` up from `e` and, if it is bound to
+/// a Module, looks `name` up in it. Returns NULL if `sym`
+/// is not qualified or `ns` is not a Module.
+///
+/// \param e - type: lenv*
+/// \param sym - type: char*
+/// \return lval*
+lval* lmod_resolve(lenv* e, char* sym);
+
+
+#endif  /// LIX_MODULE_H
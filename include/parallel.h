@@ -0,0 +1,40 @@
+#ifndef LIX_PARALLEL_H
+#define LIX_PARALLEL_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Enum for the operations lparallel can perform
+///
+/// The possible operations are:
+/// - LPAR_MAP : Applies a function to each item
+/// - LPAR_FILTER : Keeps the items matching a predicate
+/// - LPAR_REDUCE : Combines the items with an associative function
+enum { LPAR_MAP, LPAR_FILTER, LPAR_REDUCE };
+
+
+/// \brief Runs a map, filter or reduce over a thread pool.
+///
+/// \details Splits the `n` items `items` into chunks and
+/// evaluates `f` over them on the worker pool of the instance
+/// owning `e`, which the calling thread helps run. Each chunk
+/// is evaluated in its own child of `e` in which `def` binds
+/// locally, so `f` must not depend on side effects shared 
+/// between items. Results are assembled in item order so they
+/// do not depend on scheduling. A reduce folds each chunk from
+/// its first item and then folds the chunk results starting
+/// from `z`. Returns the first error (by item order) if any
+/// call fails.
+///
+/// \param e - type: lenv*
+/// \param f - type: lval*
+/// \param z - type: lval*
+/// \param items - type: lval**
+/// \param n - type: int
+/// \param op - type: int
+/// \return lval*
+lval* lparallel(lenv* e, lval* f, lval* z, lval** items, int n, int op);
+
+
+#endif  /// LIX_PARALLEL_H
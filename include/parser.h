@@ -12,6 +12,29 @@ lval* lval_read_expr(char* s, int* i, char end);
 lval* lval_read(char* s, int* i);
 
 
+/// \brief Skips whitespace and comments.
+///
+/// \details Advances `i` past any whitespace and `;`
+/// comments in `s`, stopping at the next token or the
+/// end of input.
+///
+/// \param s - type: char*
+/// \param i - type: int*
+void lval_read_skip(char* s, int* i);
+
+
+/// \brief Skips over the form starting at `s[*i]`.
+///
+/// \details Advances `i` past the form starting at
+/// `s[*i]` without building it, tracking only brackets,
+/// strings and comments. A malformed form is skipped up
+/// to where its brackets balance or the end of input.
+///
+/// \param s - type: char*
+/// \param i - type: int*
+void lval_read_scan(char* s, int* i);
+
+
 /// TODO
 lval* lval_read_str(char*s , int* i);
 
@@ -0,0 +1,158 @@
+#ifndef LIX_POOL_H
+#define LIX_POOL_H
+
+#include <types.h>
+
+#include <pthread.h>
+
+
+/// \brief Stack size of each worker thread.
+///
+/// \details Matches the usual main thread stack so
+/// code nests as deeply on a worker as it does on the
+/// main thread.
+#define LPOOL_STACK_SIZE (8 * 1024 * 1024)
+
+
+/// \brief Represents a unit of work for a pool.
+///
+/// A `lpool_task` consists of a:
+/// - run       : function called with `arg` on a worker
+/// - release   : function called with `arg` once `group` is notified (optional)
+/// - arg       : void* passed to `run`
+/// - group     : lpool_group* notified once `run` returns
+typedef struct lpool_task
+{
+    void (*run)(void*);
+    void (*release)(void*);
+    void* arg;
+
+    struct lpool_group* group;
+} lpool_task;
+
+
+/// \brief Represents a set of tasks that can be waited on.
+///
+/// A `lpool_group` consists of a:
+/// - pending   : atomic int corresponding to the number of unfinished tasks
+typedef struct lpool_group
+{
+    _Atomic int pending;
+} lpool_group;
+
+
+/// \brief Represents the task queue of one thread.
+///
+/// The owning thread pushes and pops tasks at the tail
+/// so it runs its most recent (and most nested) work first,
+/// while idle threads steal the oldest tasks from the head.
+///
+/// A `lpool_deque` consists of a:
+/// - lock      : pthread_mutex_t guarding the queue
+/// - items     : lpool_task** corresponding to a ring buffer of tasks
+/// - cap       : int corresponding to the size of `items` (a power of 2)
+/// - head      : int corresponding to the oldest task
+/// - tail      : int corresponding to one past the newest task
+typedef struct lpool_deque
+{
+    pthread_mutex_t lock;
+
+    lpool_task** items;
+    int cap;
+    int head;
+    int tail;
+} lpool_deque;
+
+
+/// \brief Represents a fixed-size work-stealing pool of threads.
+///
+/// Every worker owns a deque and one more deque takes the
+/// tasks submitted by threads outside the pool. Workers run
+/// their own tasks first and steal from the other deques
+/// when they run out.
+///
+/// A `lpool` consists of a:
+/// - workers   : int corresponding to the number of threads
+/// - threads   : pthread_t* corresponding to the worker threads
+/// - size      : int corresponding to the number of deques
+/// - deques    : lpool_deque* corresponding to a deque per worker and one for other threads
+/// - lock      : pthread_mutex_t guarding sleeping on `ready`
+/// - ready     : pthread_cond_t signalled when a task is queued or a group finishes
+/// - all       : lpool_group counting every unfinished task
+/// - queued    : atomic int corresponding to the number of queued tasks
+/// - stop      : int set when the pool is shutting down
+typedef struct lpool
+{
+    int workers;
+    pthread_t* threads;
+
+    int size;
+    lpool_deque* deques;
+
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+
+    lpool_group all;
+    _Atomic int queued;
+    int stop;
+} lpool;
+
+
+////////////////////////////
+/// `lpool` Constructors ///
+////////////////////////////
+
+/// \brief Starts a pool of `workers` threads.
+///
+/// \param workers - type: int
+/// \return lpool*
+lpool* lpool_new(int workers);
+
+
+///////////////////////////
+/// `lpool` Destructors ///
+///////////////////////////
+
+/// \brief Stops and frees the pool `p`.
+///
+/// \details Runs any tasks still queued, then joins
+/// every worker and frees the pool.
+///
+/// \param p - type: lpool*
+void lpool_del(lpool* p);
+
+
+///////////////////////
+/// `lpool` Methods ///
+///////////////////////
+
+/// \brief Queues `run(arg)` on the pool `p` as part of `g`.
+///
+/// \details Queues the task on the deque of the calling
+/// thread if it is a worker of `p`. Once `run` returns and
+/// `g` has been notified, `release(arg)` is called (if given)
+/// so a task can free state that `g` lives in.
+///
+/// \param p - type: lpool*
+/// \param g - type: lpool_group*
+/// \param run - type: void(*)(void*)
+/// \param release - type: void(*)(void*)
+/// \param arg - type: void*
+void lpool_submit(lpool* p, lpool_group* g, void (*run)(void*), 
+                  void (*release)(void*), void* arg);
+
+
+/// \brief Waits for every task of the group `g` to finish.
+///
+/// \details Waits for every task of the group `g` to
+/// finish, running queued tasks on the calling thread in
+/// the meantime so that waiting from within a task cannot
+/// deadlock the pool. Waiting on `p->all` waits for the
+/// pool to go quiet, which never happens from within a task.
+///
+/// \param p - type: lpool*
+/// \param g - type: lpool_group*
+void lpool_wait(lpool* p, lpool_group* g);
+
+
+#endif  /// LIX_POOL_H
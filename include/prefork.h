@@ -0,0 +1,41 @@
+#ifndef LIX_PREFORK_H
+#define LIX_PREFORK_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Serves requests from a pool of pre-forked workers.
+///
+/// \details Forks `workers` processes off the warm instance
+/// `c`, so each starts with the prelude and everything
+/// loaded into `c` already in place, sharing those pages
+/// copy-on-write. The supervisor itself evaluates nothing:
+/// it reads requests from stdin (or every connection to a
+/// Unix-domain socket at `socket`, if not NULL), hands each
+/// to an idle worker over a pipe and relays the response,
+/// framed as lserve_stream frames them.
+///
+/// Each connection has one request at a time in flight, so
+/// its responses keep the order of its requests, while
+/// connections are served by different workers at once. A
+/// worker is replaced by a fresh fork once it has served
+/// `max_requests` requests or its resident size exceeds
+/// `max_rss` kilobytes (either 0 for no limit), or if it
+/// dies, in which case its request is answered with an
+/// error.
+///
+/// Returns once stdin ends (after answering every request
+/// read from it) or if serving fails. Returns an error if
+/// the platform cannot fork.
+///
+/// \param c - type: lctx*
+/// \param socket - type: char*
+/// \param workers - type: int
+/// \param max_requests - type: int
+/// \param max_rss - type: long
+/// \return lval*
+lval* lprefork_serve(lctx* c, char* socket, int workers, int max_requests, long max_rss);
+
+
+#endif  /// LIX_PREFORK_H
@@ -0,0 +1,112 @@
+#ifndef LIX_PROFILE_H
+#define LIX_PROFILE_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Microseconds of CPU time between samples asked of
+/// the timer, which may fire less often.
+#define LPROF_INTERVAL 1000
+
+
+/// \brief Number of functions listed in a report.
+#define LPROF_TOP 20
+
+
+/// \brief Represents a function or stack seen by a profiler
+///
+/// A `lprof_entry` consists of a:
+/// - key       : char* corresponding to the function's name (or the stack, folded)
+/// - self      : long corresponding to the samples taken with it on top of the stack
+/// - total     : long corresponding to the samples taken with it anywhere on the stack
+/// - stamp     : long corresponding to the last sample counted in `total`
+/// - next      : lprof_entry* corresponding to the next entry in its bucket
+typedef struct lprof_entry
+{
+    char* key;
+
+    long self;
+    long total;
+    long stamp;
+
+    struct lprof_entry* next;
+} lprof_entry;
+
+
+/// \brief Represents a sampling profiler
+///
+/// A `lprof` keeps a shadow stack of the lambdas an
+/// instance is calling, by the name each was defined
+/// under. A SIGPROF timer counts ticks of CPU time and the
+/// ticks are charged to the stack at the next call or
+/// return, where taking a sample is safe.
+///
+/// A `lprof` consists of a:
+/// - stack     : lprof_entry** corresponding to the functions being called, innermost last
+/// - depth     : int corresponding to the number of calls on `stack`
+/// - cap       : int corresponding to the capacity of `stack`
+/// - fns       : lprof_entry** corresponding to the buckets of functions seen
+/// - stacks    : lprof_entry** corresponding to the buckets of folded stacks seen
+/// - samples   : long corresponding to the number of samples taken
+/// - cpu       : double corresponding to the CPU time of the process when profiling started, in milliseconds
+typedef struct lprof
+{
+    lprof_entry** stack;
+    int depth;
+    int cap;
+
+    lprof_entry** fns;
+    lprof_entry** stacks;
+    long samples;
+    double cpu;
+} lprof;
+
+
+/////////////////
+/// Profiling ///
+/////////////////
+
+/// \brief Starts profiling the calls of instance `c`.
+///
+/// \details Starts sampling the calls made by `c` (not by
+/// the tasks it spawns) every LPROF_INTERVAL microseconds
+/// of CPU time used by the process. Returns an error if
+/// `c` is already profiled or the platform has no SIGPROF
+/// timer.
+///
+/// \param c - type: lctx*
+/// \return lval*
+lval* lprof_start(lctx* c);
+
+
+/// \brief Stops profiling instance `c` and reports.
+///
+/// \details Writes the samples taken as folded stacks
+/// (one `f;g;h count` line per stack, as flamegraph.pl
+/// reads them) to `path` and a table of the LPROF_TOP
+/// functions with the most self time to `out`, timed by
+/// sharing the CPU time measured between the samples.
+/// Returns an error if `path` cannot be written.
+///
+/// \param c - type: lctx*
+/// \param path - type: char*
+/// \param out - type: FILE*
+/// \return lval*
+lval* lprof_stop(lctx* c, char* path, FILE* out);
+
+
+/// \brief Records a call to the lambda `f`.
+///
+/// \param p - type: lprof*
+/// \param f - type: lval*
+void lprof_enter(lprof* p, lval* f);
+
+
+/// \brief Records the return of the innermost call.
+///
+/// \param p - type: lprof*
+void lprof_leave(lprof* p);
+
+
+#endif  /// LIX_PROFILE_H
@@ -0,0 +1,131 @@
+#ifndef LIX_SEQ_H
+#define LIX_SEQ_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Iteration state over a lazy sequence.
+///
+/// An `lseq_iter` mirrors the stage chain of the `lseq`
+/// it walks so that a whole pipeline can be pulled one
+/// item at a time without building any intermediate lists.
+///
+/// A `lseq_iter` consists of a:
+/// - seq       : lseq* corresponding to the stage being walked
+/// - pos       : long corresponding to the cursor of a source or take stage
+/// - done      : int set once the stage is exhausted
+/// - inner     : lseq_iter* corresponding to the iterator of the inner stage
+typedef struct lseq_iter
+{
+    lseq* seq;
+    long pos;
+    int done;
+
+    struct lseq_iter* inner;
+} lseq_iter;
+
+
+///////////////////////////
+/// `lseq` Constructors ///
+///////////////////////////
+
+/// \brief Constructs a range source.
+///
+/// \details Constructs a sequence yielding the numbers
+/// from `start` up to (but not including) `end` in
+/// increments of `step`.
+///
+/// \param start - type: long
+/// \param end - type: long
+/// \param step - type: long
+/// \return lseq*
+lseq* lseq_range(long start, long end, long step);
+
+
+/// \brief Constructs a Q-Expression source.
+///
+/// \details Constructs a sequence yielding the elements
+/// of the Q-Expression `q`. Takes ownership of `q`.
+///
+/// \param q - type: lval*
+/// \return lseq*
+lseq* lseq_qexpr(lval* q);
+
+
+/// \brief Constructs a stage over the sequence `inner`.
+///
+/// \details Constructs a stage of kind `kind` pulling from
+/// `inner`. Takes ownership of `func` (if any) and of the
+/// reference to `inner`.
+///
+/// \param kind - type: int
+/// \param func - type: lval*
+/// \param n - type: long
+/// \param inner - type: lseq*
+/// \return lseq*
+lseq* lseq_stage(int kind, lval* func, long n, lseq* inner);
+
+
+/// \brief Adds a reference to the sequence `s`.
+///
+/// \param s - type: lseq*
+/// \return lseq*
+lseq* lseq_ref(lseq* s);
+
+
+/// \brief Drops a reference to the sequence `s`.
+///
+/// \details Drops a reference to the sequence `s`
+/// and frees it once the last reference is gone.
+///
+/// \param s - type: lseq*
+void lseq_unref(lseq* s);
+
+
+////////////////////////
+/// `lseq` Iteration ///
+////////////////////////
+
+/// \brief Starts an iteration over the sequence `s`.
+///
+/// \param s - type: lseq*
+/// \return lseq_iter*
+lseq_iter* lseq_iter_new(lseq* s);
+
+
+/// \brief Frees the iterator `it`.
+///
+/// \param it - type: lseq_iter*
+void lseq_iter_del(lseq_iter* it);
+
+
+/// \brief Pulls the next item out of the iterator `it`.
+///
+/// \details Pulls the next item through every stage of
+/// the pipeline. Returns NULL once the sequence is exhausted
+/// or an lval of type LVAL_ERR if a stage fails, after which
+/// the iterator is exhausted.
+///
+/// \param e - type: lenv*
+/// \param it - type: lseq_iter*
+/// \return lval*
+lval* lseq_iter_next(lenv* e, lseq_iter* it);
+
+
+/// \brief Converts a sequenceable lval into a sequence.
+///
+/// \details Returns a new reference to the sequence held by
+/// `v` or wraps a copy of `v` if it is a Q-Expression
+/// or Array. Arrays are shared rather than copied. 
+/// Hash-Maps yield a `{key value}` pair per entry and
+/// Hash-Sets yield their items. Generators are shared, so
+/// every sequence over one pulls from the same stream.
+/// Returns NULL for any other type.
+///
+/// \param v - type: lval*
+/// \return lseq*
+lseq* lseq_of(lval* v);
+
+
+#endif  /// LIX_SEQ_H
@@ -0,0 +1,96 @@
+#ifndef LIX_SERVE_H
+#define LIX_SERVE_H
+
+#include <lval.h>
+#include <types.h>
+
+#include <stdio.h>
+
+
+/// \brief Longest request accepted, in bytes.
+#define LSERVE_MAX_REQUEST (64 * 1024 * 1024)
+
+
+/////////////////////////
+/// Evaluation Server ///
+/////////////////////////
+
+/// \brief Serves requests read from `in` until it ends.
+///
+/// \details Evaluates each request read from `in` against
+/// the warm global environment of `c` and writes a response
+/// for it to `out`.
+///
+/// A request is either a single line of source, or a line
+/// `#n` followed by exactly `n` bytes of source, for
+/// sources spanning several lines. Blank lines between
+/// requests are skipped. Each is evaluated in a
+/// fresh child of the global environment, so its `def`s do
+/// not outlive it.
+///
+/// A response is a line `ok <length> <micros>` or
+/// `err <length> <micros>`, followed by `length` bytes
+/// holding whatever the request printed and then its result
+/// (or error) as printed, with `micros` the time spent
+/// evaluating it. Returns an error if a request is
+/// malformed, otherwise once `in` ends.
+///
+/// \param c - type: lctx*
+/// \param in - type: FILE*
+/// \param out - type: FILE*
+/// \return lval*
+lval* lserve_stream(lctx* c, FILE* in, FILE* out);
+
+
+/// \brief Serves requests over a Unix-domain socket.
+///
+/// \details Listens on a socket at `path` and serves each
+/// connection in turn as lserve_stream does, until the
+/// socket fails. Returns an error if it cannot listen or
+/// the platform has no Unix-domain sockets.
+///
+/// \param c - type: lctx*
+/// \param path - type: char*
+/// \return lval*
+lval* lserve_socket(lctx* c, char* path);
+
+
+///////////////
+/// Writing ///
+///////////////
+
+/// \brief Stops SIGPIPE being raised on the calling thread.
+///
+/// \details Blocks SIGPIPE on the calling thread only, so a
+/// write to a peer that has hung up fails with EPIPE instead
+/// of ending the process. Returns whether it was blocked
+/// already, to be passed to lserve_pipe_unblock.
+///
+/// \return int
+int lserve_pipe_block(void);
+
+
+/// \brief Undoes lserve_pipe_block.
+///
+/// \details Drops any SIGPIPE raised while it was blocked and
+/// unblocks it, unless it was blocked already (`was`).
+///
+/// \param was - type: int
+void lserve_pipe_unblock(int was);
+
+
+/// \brief Writes to `fd` without raising SIGPIPE.
+///
+/// \details Writes up to `n` bytes of `s` to `fd` as write
+/// does, returning how many were written or -1, but failing
+/// with EPIPE rather than raising SIGPIPE if the other end is
+/// closed. Leaves how the process handles SIGPIPE unchanged.
+///
+/// \param fd - type: int
+/// \param s - type: const char*
+/// \param n - type: long
+/// \return long
+long lserve_send(int fd, const char* s, long n);
+
+
+#endif  /// LIX_SERVE_H
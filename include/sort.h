@@ -0,0 +1,45 @@
+#ifndef LIX_SORT_H
+#define LIX_SORT_H
+
+#include <lval.h>
+#include <types.h>
+
+
+/// \brief Number of items from which a native sort runs in parallel.
+#define LSORT_PARALLEL_MIN 65536
+
+
+/// \brief Sorts the items `items` in place.
+///
+/// \details Stable merge sort of the `n` items `items`. If
+/// `f` is NULL items are ordered by lval_cmp, otherwise `f`
+/// is called as a "less than" predicate on pairs of items.
+/// Without `f`, or when `f` is one of the builtin ordering
+/// operators and every item is a Number, no Lix code is run
+/// and inputs of at least LSORT_PARALLEL_MIN items are 
+/// sorted on multiple threads. Returns NULL on success or
+/// the first error raised by `f`, in which case the order
+/// of `items` is unspecified.
+///
+/// \param e - type: lenv*
+/// \param f - type: lval*
+/// \param items - type: lval**
+/// \param n - type: int
+/// \return lval*
+lval* lsort(lenv* e, lval* f, lval** items, int n);
+
+
+/// \brief Binary searches the sorted items `items` for `x`.
+///
+/// \details Searches the `n` items `items`, which must be
+/// ordered by lval_cmp, for an item equal to `x`. Returns 
+/// its index or -1 if there is none.
+///
+/// \param items - type: lval**
+/// \param n - type: int
+/// \param x - type: lval*
+/// \return int
+int lsort_search(lval** items, int n, lval* x);
+
+
+#endif  /// LIX_SORT_H
@@ -0,0 +1,142 @@
+#ifndef LIX_TRACE_H
+#define LIX_TRACE_H
+
+#include <lval.h>
+#include <types.h>
+#include <writer.h>
+
+#include <pthread.h>
+#include <stdio.h>
+
+
+/// \brief Default shortest lambda call traced, in microseconds.
+#define LTRACE_THRESHOLD 100
+
+
+/// \brief Bytes of events gathered before they are handed
+/// to the writer thread.
+#define LTRACE_CHUNK (256 * 1024)
+
+
+/// \brief Longest name given to an event for a form.
+#define LTRACE_NAME_MAX 80
+
+
+/// \brief Represents a timeline being traced
+///
+/// Events are gathered into `buf` by the traced instance
+/// and handed to a thread of the trace's own a chunk at a
+/// time, so the instance never waits on the file unless
+/// the thread falls a whole chunk behind.
+///
+/// A `ltrace` consists of a:
+/// - file      : FILE* corresponding to where the trace is written
+/// - buf       : lwriter* corresponding to the events gathered since the last hand-off
+/// - pending   : lwriter* corresponding to the events handed to the thread (optional)
+/// - stop      : int set once the thread should write what is pending and exit
+/// - failed    : int set once writing to `file` fails
+/// - thread    : pthread_t corresponding to the thread writing `file`
+/// - lock      : pthread_mutex_t guarding `pending`, `stop` and `failed`
+/// - cond      : pthread_cond_t signalled when `pending` or `stop` changes
+/// - start     : long long corresponding to when tracing started, in microseconds
+/// - threshold : long corresponding to the shortest lambda call traced, in microseconds
+/// - pid       : int corresponding to the process being traced
+/// - starts    : long long* corresponding to when each lambda call being made started
+/// - depth     : int corresponding to the number of calls in `starts`
+/// - cap       : int corresponding to the capacity of `starts`
+typedef struct ltrace
+{
+    FILE* file;
+    lwriter* buf;
+    lwriter* pending;
+    int stop;
+    int failed;
+
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+
+    long long start;
+    long threshold;
+    int pid;
+
+    long long* starts;
+    int depth;
+    int cap;
+} ltrace;
+
+
+///////////////
+/// Tracing ///
+///////////////
+
+/// \brief Starts tracing instance `c` to `path`.
+///
+/// \details Starts writing a timeline of `c` (not of the
+/// tasks it spawns) to `path` as Chrome trace-event JSON:
+/// begin and end events for each `load` and each form it
+/// evaluates, and a complete event for each named lambda
+/// call lasting at least `threshold` microseconds. Returns
+/// an error if `c` is already traced or `path` cannot be
+/// opened.
+///
+/// \param c - type: lctx*
+/// \param path - type: char*
+/// \param threshold - type: long
+/// \return lval*
+lval* ltrace_start(lctx* c, char* path, long threshold);
+
+
+/// \brief Stops tracing instance `c`.
+///
+/// \details Writes the events still gathered, closes the
+/// timeline and waits for the writer thread. Returns an
+/// error if writing the trace failed.
+///
+/// \param c - type: lctx*
+/// \return lval*
+lval* ltrace_stop(lctx* c);
+
+
+/// \brief Begins an event `name` of category `cat`.
+///
+/// \param t - type: ltrace*
+/// \param cat - type: char*
+/// \param name - type: char*
+void ltrace_begin(ltrace* t, char* cat, char* name);
+
+
+/// \brief Begins an event for evaluating the form `v`.
+///
+/// \details Names the event after `v` as printed, cut
+/// short at LTRACE_NAME_MAX characters.
+///
+/// \param t - type: ltrace*
+/// \param v - type: lval*
+void ltrace_form(ltrace* t, lval* v);
+
+
+/// \brief Ends the innermost event begun of category `cat`.
+///
+/// \param t - type: ltrace*
+/// \param cat - type: char*
+void ltrace_end(ltrace* t, char* cat);
+
+
+/// \brief Records the start of a call to a lambda.
+///
+/// \param t - type: ltrace*
+void ltrace_enter(ltrace* t);
+
+
+/// \brief Records the return of the innermost call, to `f`.
+///
+/// \details Adds a complete event for the call if it took
+/// at least the threshold of `t`.
+///
+/// \param t - type: ltrace*
+/// \param f - type: lval*
+void ltrace_leave(ltrace* t, lval* f);
+
+
+#endif  /// LIX_TRACE_H
@@ -1,6 +1,17 @@
 #ifndef LIX_TYPES_H
 #define LIX_TYPES_H
 
+/// Exposes pthread_rwlock_t under strict ISO C.
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <stdio.h>
+
+
+/// Version of the interpreter, also keying cached files.
+#define LIX_VERSION "0.3.1"
 
 
 struct lval;
@@ -10,6 +21,58 @@ typedef struct lval lval;
 struct lenv;
 typedef struct lenv lenv;
 
+
+struct lctx;
+typedef struct lctx lctx;
+
+
+struct lpool;
+typedef struct lpool lpool;
+
+
+struct lseq;
+typedef struct lseq lseq;
+
+
+struct larr;
+typedef struct larr larr;
+
+
+struct lhamt;
+typedef struct lhamt lhamt;
+
+
+struct lfut;
+typedef struct lfut lfut;
+
+
+struct lactor;
+typedef struct lactor lactor;
+
+
+struct lgen;
+typedef struct lgen lgen;
+
+
+struct lloop;
+typedef struct lloop lloop;
+
+
+struct lmod;
+typedef struct lmod lmod;
+
+
+struct llazy;
+typedef struct llazy llazy;
+
+
+struct lprof;
+typedef struct lprof lprof;
+
+
+struct ltrace;
+typedef struct ltrace ltrace;
+
 typedef lval*(*lbuiltin)(lenv*, lval*);
 
 // typedef lval*(*builtinload)(lenv*, lval*, mpc_parser_t*);
@@ -21,8 +84,18 @@ typedef lval*(*lbuiltin)(lenv*, lval*);
 /// - type      : int corresponding to an enum value 
 /// - num       : long coresonding to a number
 /// - err       : char* corresponding to an error message (optional)
-/// - sym       : char* corresponding to a symbol or operator (optional)
+/// - sym       : char* corresponding to a symbol or operator, or the name a lambda
+///               was defined under (optional)
+/// - home      : lenv* corresponding to the namespace a function evaluates in (optional)
+/// - seq       : lseq* corresponding to a lazy sequence (optional)
+/// - arr       : larr* corresponding to a mutable array (optional)
+/// - hamt      : lhamt* corresponding to the root of a hash-map or hash-set (optional)
+/// - fut       : lfut* corresponding to the result of a spawned task (optional)
+/// - actor     : lactor* corresponding to an actor (optional)
+/// - gen       : lgen* corresponding to a generator (optional)
+/// - mod       : lmod* corresponding to a module (optional)
 /// - count     : int corresponding to the number of elements in the `cell` array
+///               (or in the `hamt` of a hash-map or hash-set)
 /// - cell      : lval** corresponding to an array of lvals
 typedef struct lval
 {
@@ -37,6 +110,15 @@ typedef struct lval
     lenv* env;
     lval* formals;
     lval* body;
+    lenv* home;
+
+    lseq* seq;
+    larr* arr;
+    lhamt* hamt;
+    lfut* fut;
+    lactor* actor;
+    lgen* gen;
+    lmod* mod;
 
     int count;
     struct lval** cell;
@@ -53,17 +135,215 @@ typedef struct lval
 /// - LVAL_FUN : Function type
 /// - LVAL_SEXPR : S-Expression type
 /// - LVAL_QEXPR : Q-Expression type
+/// - LVAL_SEQ : Lazy sequence type
+/// - LVAL_ARR : Mutable array type
+/// - LVAL_MAP : Hash-map type
+/// - LVAL_SET : Hash-set type
+/// - LVAL_RECUR : Pending `recur` of a `loop` type
+/// - LVAL_FUT : Future type
+/// - LVAL_ACTOR : Actor type
+/// - LVAL_GEN : Generator type
+/// - LVAL_MOD : Module type
 enum { LVAL_ERR, LVAL_NUM, LVAL_SYM, LVAL_STR, 
-       LVAL_FUN, LVAL_SEXPR, LVAL_QEXPR };
+       LVAL_FUN, LVAL_SEXPR, LVAL_QEXPR, LVAL_SEQ,
+       LVAL_ARR, LVAL_MAP, LVAL_SET, LVAL_RECUR,
+       LVAL_FUT, LVAL_ACTOR, LVAL_GEN, LVAL_MOD };
 
 
+/// \brief Represents a Lisp Environment
+///
+/// A `lenv` consists of a:
+/// - par       : lenv* corresponding to the enclosing environment
+/// - ctx       : lctx* corresponding to the interpreter owning the environment
+/// - root      : int set if `def` binds in this environment rather than its parents
+/// - count     : int corresponding to the number of bindings
+/// - syms      : char** corresponding to the bound symbols
+/// - vals      : lval** corresponding to the bound values
+/// - index     : int* corresponding to a hash table of positions in `syms`, plus one (optional)
+/// - slots     : int corresponding to the size of `index`
 typedef struct lenv 
 {
     lenv* par;
+    lctx* ctx;
+    int root;
     
     int count;
     char** syms;
     lval** vals;
+
+    int* index;
+    int slots;
 } lenv;
 
+
+/// \brief Represents an interpreter instance
+///
+/// Everything an interpreter mutates lives in its `lctx`
+/// or in values reachable from it, so independent instances
+/// can run on separate threads at the same time. Values are
+/// allocated with malloc.
+///
+/// A `lctx` consists of a:
+/// - env       : lenv* corresponding to the global environment
+/// - out       : FILE* corresponding to where output is written
+/// - max_depth : int corresponding to the limit on nested function calls
+/// - depth     : int corresponding to the current nesting of function calls
+/// - loops     : int corresponding to the `loop` bodies being evaluated within the innermost call
+/// - owner     : lctx* corresponding to the instance (itself unless a task's context)
+/// - gen       : lgen* corresponding to the generator being run (optional)
+/// - pool      : lpool* corresponding to the worker pool of an instance (optional)
+/// - loop      : lloop* corresponding to the event loop of an instance (optional)
+/// - modules   : lmod* corresponding to the modules loaded by an instance
+/// - lazy      : llazy* corresponding to the definitions of an instance not yet bound (optional)
+/// - prof      : lprof* corresponding to the profiler sampling the calls of the context (optional)
+/// - trace     : ltrace* corresponding to the timeline the context is traced to (optional)
+/// - workers   : int corresponding to the number of workers the pool is built with
+/// - chunk     : int corresponding to the items per parallel task (0 to pick automatically)
+/// - threaded  : int set once the instance has started worker threads, after which `lock` guards `env`
+/// - lock      : pthread_rwlock_t guarding `env` against tasks running alongside its owner
+typedef struct lctx
+{
+    lenv* env;
+    FILE* out;
+
+    int max_depth;
+    int depth;
+    int loops;
+
+    struct lctx* owner;
+    lgen* gen;
+
+    lpool* pool;
+    lloop* loop;
+    lmod* modules;
+    llazy* lazy;
+    lprof* prof;
+    ltrace* trace;
+    int workers;
+    int chunk;
+    int threaded;
+
+    pthread_rwlock_t lock;
+} lctx;
+
+
+/// \brief Represents a stage of a lazy sequence
+///
+/// A `lseq` is an immutable, reference counted description
+/// of a pipeline. Sources (ranges and Q-Expressions) sit at the
+/// bottom of the chain and each stage pulls from its `inner` 
+/// sequence. Iteration state lives in a separate `lseq_iter`.
+///
+/// A `lseq` consists of a:
+/// - refs      : atomic int corresponding to the number of owners
+/// - kind      : int corresponding to an LSEQ enum value
+/// - start     : long corresponding to the first value of a range
+/// - end       : long corresponding to the (exclusive) end of a range
+/// - step      : long corresponding to the step of a range
+/// - n         : long corresponding to the limit of a take stage
+/// - src       : lval* corresponding to a Q-Expression, Array or Generator source (optional)
+/// - func      : lval* corresponding to a stage's function (optional)
+/// - inner     : lseq* corresponding to the sequence being pulled from
+typedef struct lseq
+{
+    _Atomic int refs;
+    int kind;
+
+    long start;
+    long end;
+    long step;
+    long n;
+
+    lval* src;
+    lval* func;
+
+    struct lseq* inner;
+} lseq;
+
+
+/// \brief Enum for possible lseq kinds
+///
+/// The possible lseq kinds are:
+/// - LSEQ_RANGE : Range of numbers source
+/// - LSEQ_QEXPR : Q-Expression source
+/// - LSEQ_ARRAY : Array source
+/// - LSEQ_GEN : Generator source
+/// - LSEQ_MAP : Applies a function to each item
+/// - LSEQ_FILTER : Keeps items matching a predicate
+/// - LSEQ_TAKE : Stops after `n` items
+/// - LSEQ_TAKE_WHILE : Stops at the first item failing a predicate
+enum { LSEQ_RANGE, LSEQ_QEXPR, LSEQ_ARRAY, LSEQ_GEN, 
+       LSEQ_MAP, LSEQ_FILTER, LSEQ_TAKE, LSEQ_TAKE_WHILE };
+
+
+/// \brief Represents a mutable array
+///
+/// A `larr` is shared (not copied) between every lval
+/// that refers to it, so updates through one are seen by
+/// all of them.
+///
+/// A `larr` consists of a:
+/// - refs      : atomic int corresponding to the number of owners
+/// - count     : int corresponding to the number of items
+/// - cap       : int corresponding to the allocated size of `items`
+/// - items     : lval** corresponding to the array of items
+typedef struct larr
+{
+    _Atomic int refs;
+
+    int count;
+    int cap;
+    lval** items;
+} larr;
+
+
+/// \brief Represents an entry of a hash-map or hash-set
+///
+/// Entries are immutable once built and shared between
+/// every version of a map that still holds them.
+///
+/// A `lhent` consists of a:
+/// - refs      : atomic int corresponding to the number of owners
+/// - hash      : unsigned long corresponding to the structural hash of `key`
+/// - key       : lval* corresponding to the key
+/// - val       : lval* corresponding to the value (NULL in a hash-set)
+typedef struct lhent
+{
+    _Atomic int refs;
+    unsigned long hash;
+
+    lval* key;
+    lval* val;
+} lhent;
+
+
+/// \brief Represents a node of a hash array mapped trie
+///
+/// A node holds up to 32 slots, one per 5 bit chunk of
+/// a key's hash, each being either an entry or a child
+/// node. Nodes are never changed once built; updates copy
+/// the path down to the changed slot and share the rest.
+/// Keys whose hashes are equal in every bit end up in a
+/// `collision` node which is searched linearly.
+///
+/// A `lhamt` consists of a:
+/// - refs      : atomic int corresponding to the number of owners
+/// - collision : int set if the node holds colliding entries
+/// - bitmap    : unsigned int corresponding to which slots are present
+/// - count     : int corresponding to the number of slots
+/// - ents      : lhent** corresponding to the entry of each slot (if any)
+/// - nodes     : lhamt** corresponding to the child of each slot (if any)
+typedef struct lhamt
+{
+    _Atomic int refs;
+    int collision;
+
+    unsigned int bitmap;
+    int count;
+
+    lhent** ents;
+    struct lhamt** nodes;
+} lhamt;
+
+
 #endif  // LIX_TYPES_H
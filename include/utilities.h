@@ -27,6 +27,28 @@
 char* ltype_name(int t);
 
 
+/// \brief Returns the number of online processors.
+///
+/// \details Returns the number of processors currently
+/// online, or 1 if it cannot be determined.
+///
+/// \return int
+int lix_cpu_count(void);
+
+
+/// \brief Reads the whole of the file at `path`.
+///
+/// \details Returns the contents of the file at `path` in
+/// a null terminated buffer, storing their length in `len`,
+/// or NULL if it cannot be read. The buffer is freed by
+/// the caller.
+///
+/// \param path - type: char*
+/// \param len - type: long*
+/// \return char*
+char* lix_read_file(char* path, long* len);
+
+
 
 
 #endif  /// LIX_UTILITIES_H
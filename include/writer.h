@@ -0,0 +1,139 @@
+#ifndef LIX_WRITER_H
+#define LIX_WRITER_H
+
+#include <types.h>
+
+#include <stdio.h>
+
+
+/// \brief Size of the buffer of a writer to a file.
+#define LWRITER_BUFFER_SIZE (64 * 1024)
+
+
+/// \brief Enum for possible writer sinks
+///
+/// The possible sinks are:
+/// - LWRITER_FILE : Writes through a FILE*
+/// - LWRITER_FD : Writes straight to a file descriptor
+/// - LWRITER_STR : Collects everything into a string
+enum { LWRITER_FILE, LWRITER_FD, LWRITER_STR };
+
+
+/// \brief Buffers output on its way to a sink.
+///
+/// Output is gathered into `data` and handed to the sink
+/// a buffer at a time, so printing a large value costs a
+/// handful of writes rather than one per character. A
+/// writer to a string never flushes; `data` grows to hold
+/// everything written to it.
+///
+/// A `lwriter` consists of a:
+/// - sink      : int corresponding to an enum value
+/// - file      : FILE* written to by a LWRITER_FILE writer
+/// - fd        : int written to by a LWRITER_FD writer
+/// - data      : char* corresponding to the buffered output
+/// - len       : long corresponding to the length of `data`
+/// - cap       : long corresponding to the capacity of `data`
+/// - failed    : int set once writing to the sink fails
+typedef struct lwriter
+{
+    int sink;
+    FILE* file;
+    int fd;
+
+    char* data;
+    long len;
+    long cap;
+
+    int failed;
+} lwriter;
+
+
+//////////////////////////////
+/// `lwriter` Constructors ///
+//////////////////////////////
+
+/// \brief Constructs a writer to the file `f`.
+///
+/// \param f - type: FILE*
+/// \return lwriter*
+lwriter* lwriter_file(FILE* f);
+
+
+/// \brief Constructs a writer to the file descriptor `fd`.
+///
+/// \param fd - type: int
+/// \return lwriter*
+lwriter* lwriter_fd(int fd);
+
+
+/// \brief Constructs a writer collecting a string.
+///
+/// \return lwriter*
+lwriter* lwriter_str(void);
+
+
+/// \brief Flushes and frees the writer `w`.
+///
+/// \details Hands what is left in `w` to its sink and
+/// frees `w`, leaving the sink open. Returns 0 if anything
+/// written to the sink was lost.
+///
+/// \param w - type: lwriter*
+/// \return int
+int lwriter_close(lwriter* w);
+
+
+/// \brief Takes the string collected by `w`.
+///
+/// \details Frees the string writer `w` and returns
+/// its null terminated contents, which the caller frees.
+///
+/// \param w - type: lwriter*
+/// \return char*
+char* lwriter_take(lwriter* w);
+
+
+/////////////////////////
+/// `lwriter` Methods ///
+/////////////////////////
+
+/// \brief Writes `n` bytes at `s` to `w`.
+///
+/// \param w - type: lwriter*
+/// \param s - type: const char*
+/// \param n - type: long
+void lwriter_put(lwriter* w, const char* s, long n);
+
+
+/// \brief Writes the character `c` to `w`.
+///
+/// \param w - type: lwriter*
+/// \param c - type: char
+void lwriter_putc(lwriter* w, char c);
+
+
+/// \brief Writes the null terminated string `s` to `w`.
+///
+/// \param w - type: lwriter*
+/// \param s - type: const char*
+void lwriter_puts(lwriter* w, const char* s);
+
+
+/// \brief Writes the decimal digits of `x` to `w`.
+///
+/// \param w - type: lwriter*
+/// \param x - type: long
+void lwriter_num(lwriter* w, long x);
+
+
+/// \brief Hands everything buffered in `w` to its sink.
+///
+/// \details Does nothing for a string writer. A file
+/// writer also flushes its FILE*.
+///
+/// \param w - type: lwriter*
+void lwriter_flush(lwriter* w);
+
+
+#endif  /// LIX_WRITER_H
@@ -0,0 +1,605 @@
+/// clock_gettime is a POSIX interface.
+#define _XOPEN_SOURCE 700
+
+#include <lix.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/// Most samples taken of a benchmark.
+#define LBENCH_SAMPLES 31
+
+/// Fewest samples taken of a benchmark, however slow.
+#define LBENCH_MIN_SAMPLES 5
+
+/// Time spent on a benchmark once it has the fewest
+/// samples, in nanoseconds.
+#define LBENCH_BUDGET 1000000000LL
+
+/// Shortest sample, in nanoseconds; faster operations are
+/// repeated within a sample until they take this long.
+#define LBENCH_SAMPLE_TIME 2000000LL
+
+/// Slowdown of a median flagged as a regression, in percent.
+#define LBENCH_THRESHOLD 10.0
+
+
+/// A benchmark and the state it runs against. `run` is
+/// timed; `setup` and `teardown` are not. A `setup` or `run`
+/// that fails sets `failed`, and the benchmark is skipped.
+typedef struct lbench
+{
+    char* name;
+
+    void (*setup)(struct lbench*);
+    void (*run)(struct lbench*);
+    void (*teardown)(struct lbench*);
+
+    char* src;
+    long n;
+    long bytes;
+    int failed;
+
+    lctx* ctx;
+    lenv* env;
+    lval* expr;
+    lval* value;
+} lbench;
+
+
+static long long lbench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+/////////////////
+/// Workloads ///
+/////////////////
+
+/// Parses the source of `b` from start to end.
+static void lbench_parse_run(lbench* b)
+{
+    int pos = 0;
+
+    for (lval_read_skip(b->src, &pos); b->src[pos] != '\0'; lval_read_skip(b->src, &pos))
+        lval_del(lval_read(b->src, &pos));
+}
+
+
+static void lbench_parse_setup(lbench* b)
+{
+    char* form = "(fun {area shape} {if (== (fst shape) \"circle\") "
+                 "{* 3 (snd shape) (snd shape)} {* (snd shape) (nth 2 shape)}}) "
+                 "; a comment\n(def {xs} {1 2 3 \"four\" {5 6} seven})\n";
+    long len = strlen(form);
+
+    b->bytes = len * b->n;
+    b->src = malloc(b->bytes + 1);
+
+    for (long i = 0; i < b->n; i++)
+        memcpy(b->src + i * len, form, len);
+
+    b->src[b->bytes] = '\0';
+}
+
+
+static void lbench_parse_teardown(lbench* b)
+{
+    free(b->src);
+}
+
+
+/// Looks up the last of `n` bindings in an environment
+/// searched from the first.
+static void lbench_env_run(lbench* b)
+{
+    lval_del(lenv_get(b->env, b->value));
+}
+
+
+static void lbench_env_setup(lbench* b)
+{
+    char name[32];
+
+    b->env = lenv_new();
+
+    for (long i = 0; i < b->n; i++)
+    {
+        snprintf(name, sizeof(name), "sym%ld", i);
+
+        lval* k = lval_sym(name);
+        lval* v = lval_num(i);
+        lenv_put(b->env, k, v);
+        lval_del(k);
+        lval_del(v);
+    }
+
+    b->value = lval_sym(name);
+}
+
+
+static void lbench_env_teardown(lbench* b)
+{
+    lval_del(b->value);
+    lenv_del(b->env);
+}
+
+
+/// Prints `x` and marks `b` failed if `x` is the first
+/// error of `b`, then frees `x`.
+static void lbench_check(lbench* b, lval* x)
+{
+    if (x->type == LVAL_ERR && !b->failed)
+    {
+        fprintf(stderr, "%s: ", b->name);
+        lval_fprintln(stderr, x);
+        b->failed = 1;
+    }
+
+    lval_del(x);
+}
+
+
+/// Evaluates the expression of `b` in its instance.
+static void lbench_eval_run(lbench* b)
+{
+    lbench_check(b, lval_eval(b->ctx->env, lval_copy(b->expr)));
+}
+
+
+/// Reads `s` as the expression benchmarked, after
+/// evaluating the definitions in `defs`.
+static void lbench_eval_prepare(lbench* b, char* defs, char* s)
+{
+    lbench_check(b, lctx_eval(b->ctx, defs));
+
+    int pos = 0;
+    b->expr = lval_read(s, &pos);
+
+    if (b->expr->type == LVAL_ERR)
+        lbench_check(b, lval_copy(b->expr));
+}
+
+
+static void lbench_eval_teardown(lbench* b)
+{
+    lval_del(b->expr);
+    lctx_del(b->ctx);
+}
+
+
+static void lbench_call_setup(lbench* b)
+{
+    b->ctx = lctx_new();
+    lbench_eval_prepare(b, "(def {id} (\\ {x} {x}))", "(id 1)");
+}
+
+
+static void lbench_fib_setup(lbench* b)
+{
+    char s[32];
+    snprintf(s, sizeof(s), "(fib %ld)", b->n);
+
+    b->ctx = lctx_new();
+    lbench_eval_prepare(b, "(def {fib} (\\ {n} {if (< n 2) {n} "
+                           "{+ (fib (- n 1)) (fib (- n 2))}}))", s);
+}
+
+
+/// Sets up an instance with the prelude and a list `l`
+/// of `n` numbers, to evaluate `src` against.
+static void lbench_list_setup(lbench* b)
+{
+    char defs[64];
+    snprintf(defs, sizeof(defs), "(def {l} (collect (range 0 %ld)))", b->n);
+
+    b->ctx = lctx_new();
+    lbench_check(b, load_prelude(b->ctx->env));
+    lbench_eval_prepare(b, defs, b->src);
+}
+
+
+/// Prints a list of `n` numbers and strings.
+static void lbench_print_run(lbench* b)
+{
+    lwriter* w = lwriter_str();
+    lval_write(w, b->value);
+    b->bytes = w->len;
+    free(lwriter_take(w));
+}
+
+
+static void lbench_print_setup(lbench* b)
+{
+    b->value = lval_qexpr();
+
+    for (long i = 0; i < b->n; i++)
+        lval_add(b->value, (i % 2) ? lval_num(i * 7919) : lval_str("a \"string\"\n"));
+}
+
+
+static void lbench_print_teardown(lbench* b)
+{
+    lval_del(b->value);
+}
+
+
+/// Starts an instance and loads the prelude, as `lix`
+/// does before running anything.
+static void lbench_startup_run(lbench* b)
+{
+    lctx* c = lctx_new();
+    lval_del(load_prelude(c->env));
+    lctx_del(c);
+}
+
+
+#define LBENCH_LIST(name_, src_, n_) \
+    { .name = name_, .setup = lbench_list_setup, .run = lbench_eval_run, \
+      .teardown = lbench_eval_teardown, .src = src_, .n = n_ }
+
+
+static lbench lbench_all[] =
+{
+    { .name = "parse/100", .n = 100,
+      .setup = lbench_parse_setup, .run = lbench_parse_run, .teardown = lbench_parse_teardown },
+    { .name = "parse/10000", .n = 10000,
+      .setup = lbench_parse_setup, .run = lbench_parse_run, .teardown = lbench_parse_teardown },
+
+    { .name = "env-get/10", .n = 10,
+      .setup = lbench_env_setup, .run = lbench_env_run, .teardown = lbench_env_teardown },
+    { .name = "env-get/100", .n = 100,
+      .setup = lbench_env_setup, .run = lbench_env_run, .teardown = lbench_env_teardown },
+    { .name = "env-get/1000", .n = 1000,
+      .setup = lbench_env_setup, .run = lbench_env_run, .teardown = lbench_env_teardown },
+    { .name = "env-get/10000", .n = 10000,
+      .setup = lbench_env_setup, .run = lbench_env_run, .teardown = lbench_env_teardown },
+
+    { .name = "call",
+      .setup = lbench_call_setup, .run = lbench_eval_run, .teardown = lbench_eval_teardown },
+    { .name = "fib/15", .n = 15,
+      .setup = lbench_fib_setup, .run = lbench_eval_run, .teardown = lbench_eval_teardown },
+    { .name = "fib/20", .n = 20,
+      .setup = lbench_fib_setup, .run = lbench_eval_run, .teardown = lbench_eval_teardown },
+
+    /// The prelude's recursive list functions copy the rest
+    /// of the list at each nested call, so their time and memory
+    /// grow with the square of its length: at 3000 items a run
+    /// takes seconds, at 10000 several GB. Their builtin
+    /// counterparts below cover the larger sizes.
+    LBENCH_LIST("list/len/1000", "(len l)", 1000),
+    LBENCH_LIST("list/nth/1000", "(nth 999 l)", 1000),
+    LBENCH_LIST("list/map/1000", "(map (\\ {x} {* x 2}) l)", 1000),
+    LBENCH_LIST("list/filter/1000", "(filter (\\ {x} {> x 500}) l)", 1000),
+    LBENCH_LIST("list/foldl/1000", "(foldl + 0 l)", 1000),
+    LBENCH_LIST("list/reverse/1000", "(reverse l)", 1000),
+
+    LBENCH_LIST("list/sum/1000", "(sum l)", 1000),
+    LBENCH_LIST("list/sum/10000", "(sum l)", 10000),
+    LBENCH_LIST("list/sum/100000", "(sum l)", 100000),
+    LBENCH_LIST("list/sum/1000000", "(sum l)", 1000000),
+    LBENCH_LIST("list/seq-map/1000", "(collect (seq-map (\\ {x} {* x 2}) l))", 1000),
+    LBENCH_LIST("list/seq-map/100000", "(collect (seq-map (\\ {x} {* x 2}) l))", 100000),
+    LBENCH_LIST("list/seq-map/1000000", "(collect (seq-map (\\ {x} {* x 2}) l))", 1000000),
+    LBENCH_LIST("list/seq-filter/1000", "(collect (seq-filter (\\ {x} {> x 500}) l))", 1000),
+    LBENCH_LIST("list/seq-filter/1000000", "(collect (seq-filter (\\ {x} {> x 500}) l))", 1000000),
+    LBENCH_LIST("list/sort/1000", "(sort l)", 1000),
+    LBENCH_LIST("list/sort/1000000", "(sort l)", 1000000),
+
+    { .name = "print/1000", .n = 1000,
+      .setup = lbench_print_setup, .run = lbench_print_run, .teardown = lbench_print_teardown },
+    { .name = "print/100000", .n = 100000,
+      .setup = lbench_print_setup, .run = lbench_print_run, .teardown = lbench_print_teardown },
+
+    { .name = "startup", .run = lbench_startup_run },
+};
+
+
+/////////////////
+/// Reporting ///
+/////////////////
+
+/// Summary of the samples of a benchmark, in nanoseconds
+/// per run.
+typedef struct lbench_result
+{
+    long iterations;
+    int samples;
+
+    double median;
+    double p90;
+    double p99;
+    double min;
+    double max;
+    double mean;
+} lbench_result;
+
+
+static int lbench_cmp(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+
+/// Returns the `p`th percentile of the `n` sorted
+/// samples `xs`, by nearest rank.
+static double lbench_percentile(double* xs, int n, double p)
+{
+    int i = (int)(p / 100.0 * n + 0.999999) - 1;
+    return xs[(i < 0) ? 0 : (i >= n) ? n - 1 : i];
+}
+
+
+/// Measures `b` into `r`. Returns 0, leaving `r` unset,
+/// if `b` fails to set up or run.
+static int lbench_measure(lbench* b, lbench_result* out)
+{
+    lbench_result r;
+    double xs[LBENCH_SAMPLES];
+
+    if (b->setup)
+        b->setup(b);
+
+    /// The first run warms up and sizes the samples. One
+    /// that fails, or follows a failed setup, is not timed.
+    long long t = 0;
+
+    if (!b->failed)
+    {
+        t = lbench_now();
+        b->run(b);
+        t = lbench_now() - t;
+    }
+
+    if (b->failed)
+    {
+        if (b->teardown)
+            b->teardown(b);
+
+        return 0;
+    }
+
+    r.iterations = (t >= LBENCH_SAMPLE_TIME) ? 1 : LBENCH_SAMPLE_TIME / (t ? t : 1);
+    r.samples = 0;
+
+    long long start = lbench_now();
+
+    while (r.samples < LBENCH_SAMPLES
+           && (r.samples < LBENCH_MIN_SAMPLES || lbench_now() - start < LBENCH_BUDGET))
+    {
+        long long s = lbench_now();
+
+        for (long i = 0; i < r.iterations; i++)
+            b->run(b);
+
+        xs[r.samples++] = (double)(lbench_now() - s) / r.iterations;
+    }
+
+    if (b->teardown)
+        b->teardown(b);
+
+    if (b->failed)
+        return 0;
+
+    qsort(xs, r.samples, sizeof(double), lbench_cmp);
+
+    r.median = lbench_percentile(xs, r.samples, 50);
+    r.p90 = lbench_percentile(xs, r.samples, 90);
+    r.p99 = lbench_percentile(xs, r.samples, 99);
+    r.min = xs[0];
+    r.max = xs[r.samples - 1];
+    r.mean = 0;
+
+    for (int i = 0; i < r.samples; i++)
+        r.mean += xs[i] / r.samples;
+
+    *out = r;
+    return 1;
+}
+
+
+/// Writes each result on a line of its own, which is what
+/// lbench_load reads back.
+static void lbench_print(FILE* out, lbench* b, lbench_result* r, int first)
+{
+    fprintf(out, "%s{\"name\":\"%s\",\"iterations\":%ld,\"samples\":%d,"
+                 "\"median_ns\":%.1f,\"p90_ns\":%.1f,\"p99_ns\":%.1f,"
+                 "\"min_ns\":%.1f,\"max_ns\":%.1f,\"mean_ns\":%.1f,\"bytes\":%ld}",
+            first ? "" : ",\n", b->name, r->iterations, r->samples,
+            r->median, r->p90, r->p99, r->min, r->max, r->mean, b->bytes);
+    fflush(out);
+}
+
+
+/// A benchmark's median read back from a results file.
+typedef struct lbench_saved
+{
+    char name[64];
+    double median;
+} lbench_saved;
+
+
+/// Reads the medians from the results file at `path`
+/// into `saved`. Returns how many were read, or -1 if
+/// the file cannot be read.
+static int lbench_load(char* path, lbench_saved* saved, int max)
+{
+    FILE* f = fopen(path, "r");
+
+    if (f == NULL)
+        return -1;
+
+    char line[1024];
+    int n = 0;
+
+    while (n < max && fgets(line, sizeof(line), f))
+    {
+        char* name = strstr(line, "\"name\":\"");
+        char* median = strstr(line, "\"median_ns\":");
+
+        if (name == NULL || median == NULL)
+            continue;
+
+        name += strlen("\"name\":\"");
+        int len = (int)strcspn(name, "\"");
+
+        if (len >= (int)sizeof(saved[n].name))
+            continue;
+
+        memcpy(saved[n].name, name, len);
+        saved[n].name[len] = '\0';
+        saved[n].median = strtod(median + strlen("\"median_ns\":"), NULL);
+        n++;
+    }
+
+    fclose(f);
+    return n;
+}
+
+
+/// Compares the medians of `now` against `base`, flagging
+/// those slower by more than `threshold` percent. Returns
+/// the number of regressions.
+static int lbench_compare(FILE* out, lbench_saved* base, int nbase,
+                          lbench_saved* now, int nnow, double threshold)
+{
+    int regressions = 0;
+
+    fprintf(out, "%-24s %14s %14s %9s\n", "benchmark", "base (ns)", "now (ns)", "change");
+
+    for (int i = 0; i < nnow; i++)
+    {
+        lbench_saved* b = NULL;
+
+        for (int j = 0; j < nbase && b == NULL; j++)
+            if (strcmp(base[j].name, now[i].name) == 0)
+                b = &base[j];
+
+        if (b == NULL || b->median <= 0)
+        {
+            fprintf(out, "%-24s %14s %14.1f %9s\n", now[i].name, "-", now[i].median, "new");
+            continue;
+        }
+
+        double change = (now[i].median - b->median) / b->median * 100.0;
+        int regressed = change > threshold;
+        regressions += regressed;
+
+        fprintf(out, "%-24s %14.1f %14.1f %+8.1f%%%s\n", now[i].name, b->median,
+                now[i].median, change, regressed ? "  REGRESSION" : "");
+    }
+
+    return regressions;
+}
+
+
+static void lbench_usage(void)
+{
+    fputs("Usage: bench [--filter text] [--compare base.json [now.json]] [--threshold percent]\n"
+          "\n"
+          "Runs the benchmarks whose names contain `text` (all by default) and\n"
+          "writes their results to stdout as JSON. With --compare, compares the\n"
+          "medians against the results saved in base.json instead, either of a\n"
+          "new run or of now.json, and exits with 1 if any is more than\n"
+          "`percent` (10 by default) slower. Benchmarks that fail to set up\n"
+          "are left out and make it exit with 2.\n", stderr);
+}
+
+
+int main(int argc, char* argv[])
+{
+    char* filter = NULL;
+    char* base = NULL;
+    char* now = NULL;
+    double threshold = LBENCH_THRESHOLD;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+            threshold = atof(argv[++i]);
+        else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc)
+        {
+            base = argv[++i];
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                now = argv[++i];
+        }
+        else
+        {
+            lbench_usage();
+            return 2;
+        }
+    }
+
+    int count = sizeof(lbench_all) / sizeof(lbench_all[0]);
+    lbench_saved* saved = calloc(count, sizeof(lbench_saved));
+    lbench_saved* results = calloc(count, sizeof(lbench_saved));
+    int nresults = 0;
+    int failed = 0;
+
+    if (now)
+        nresults = lbench_load(now, results, count);
+    else
+    {
+        /// Results go to stdout as JSON unless only being
+        /// compared, when progress goes to stderr instead.
+        FILE* out = base ? stderr : stdout;
+
+        fprintf(out, "{\"lix\":\"%s\",\"benchmarks\":[\n", LIX_VERSION);
+
+        for (int i = 0; i < count; i++)
+        {
+            lbench* b = &lbench_all[i];
+
+            if (filter && strstr(b->name, filter) == NULL)
+                continue;
+
+            lbench_result r;
+
+            /// Left out of the results, as timing the error
+            /// path would pass for a valid median.
+            if (!lbench_measure(b, &r))
+            {
+                fprintf(stderr, "%s: failed, skipped.\n", b->name);
+                failed++;
+                continue;
+            }
+
+            lbench_print(out, b, &r, nresults == 0);
+
+            strcpy(results[nresults].name, b->name);
+            results[nresults++].median = r.median;
+        }
+
+        fprintf(out, "\n]}\n");
+    }
+
+    int status = failed ? 2 : 0;
+
+    if (base)
+    {
+        int nsaved = lbench_load(base, saved, count);
+
+        if (nsaved < 0 || nresults < 0)
+        {
+            fprintf(stderr, "Could not read %s.\n", (nsaved < 0) ? base : now);
+            status = 2;
+        }
+        else if (lbench_compare(stdout, saved, nsaved, results, nresults, threshold) && !status)
+            status = 1;
+    }
+
+    free(saved);
+    free(results);
+    return status;
+}
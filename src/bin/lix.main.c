@@ -1,18 +1,93 @@
 #include <lix.h>
 
 #include <stdlib.h>
+#include <string.h>
 
 
 int main(int argc, char* argv[])
 {
-    lenv* e = lenv_new();
-    lenv_add_builtins(e);
+    /// Reported once everything is freed, so anything
+    /// still live has leaked.
+    int heap_report = 0;
+    int max_depth = -1;
+
+    for (;;)
+    {
+        if (argc >= 2 && strcmp(argv[1], "--heap-report") == 0)
+            heap_report = 1;
+        else if (argc >= 3 && strcmp(argv[1], "--max-depth") == 0)
+        {
+            max_depth = atoi(argv[2]);
+            argv++;
+            argc--;
+        }
+        else
+            break;
+
+        argv++;
+        argc--;
+    }
+
+    lctx* ctx = lctx_new();
+    lenv* e = ctx->env;
+
+    /// Zero leaves calls limited only by the stack.
+    if (max_depth >= 0)
+        ctx->max_depth = max_depth;
+
+    /// Images are built from nothing but the builtins.
+    if (argc == 4 && strcmp(argv[1], "--image") == 0)
+    {
+        lval* x = limage_build(e, argv[2], argv[3]);
+        int status = x->type == LVAL_ERR;
+
+        if (status)
+            lval_fprintln(stderr, x);
+
+        lval_del(x);
+        lctx_del(ctx);
+        return status;
+    }
+
+    int serve = argc >= 2 && strcmp(argv[1], "--serve") == 0;
+    char* profile = (argc >= 3 && strcmp(argv[1], "--profile") == 0) ? argv[2] : NULL;
+    char* trace = (argc >= 3 && strcmp(argv[1], "--trace") == 0) ? argv[2] : NULL;
+    char* socket = NULL;
+    int workers = 0;
+    int max_requests = 0;
+    long max_rss = 0;
+    int first = (profile || trace) ? 3 : 1;
+
+    /// Responses own stdout while serving.
+    if (serve)
+    {
+        ctx->out = stderr;
+        first = 2;
+
+        for (; first + 1 < argc && strncmp(argv[first], "--", 2) == 0; first += 2)
+        {
+            if (strcmp(argv[first], "--socket") == 0)
+                socket = argv[first + 1];
+            else if (strcmp(argv[first], "--workers") == 0)
+                workers = atoi(argv[first + 1]);
+            else if (strcmp(argv[first], "--max-requests") == 0)
+                max_requests = atoi(argv[first + 1]);
+            else if (strcmp(argv[first], "--max-rss") == 0)
+                max_rss = atol(argv[first + 1]) * 1024;
+            else
+                break;
+        }
+    }
+
     lval* p = load_prelude(e);
 
+    if (p->type == LVAL_ERR)
+        lval_fprintln(ctx->out, p);
+
     if (argc == 1)
     {
 
-        puts("Lix v0.3.1");
+        puts("Lix v" LIX_VERSION);
         puts("Press Ctrl+C to exit.\n");
 
         while(1)
@@ -24,27 +99,88 @@ int main(int argc, char* argv[])
             int pos = 0;
             lval* expr = lval_read_expr(input, &pos, '\0');
             lval* x = lval_eval(e, expr);
-            lval_println(x);
+            lval_fprintln(ctx->out, x);
             lval_del(x);
 
             free(input);
         }
     }
 
+    /// Only the files given are profiled, not the prelude.
+    if (profile)
+    {
+        lval* x = lprof_start(ctx);
+
+        if (x->type == LVAL_ERR)
+            lval_fprintln(stderr, x);
+
+        lval_del(x);
+    }
+
+    if (trace)
+    {
+        lval* x = ltrace_start(ctx, trace, LTRACE_THRESHOLD);
+
+        if (x->type == LVAL_ERR)
+            lval_fprintln(stderr, x);
+
+        lval_del(x);
+    }
+
     if (argc >= 2)
-        for (int i = 1; i < argc; ++i)
+        for (int i = first; i < argc; ++i)
         {
             lval* args = lval_add(lval_sexpr(), lval_str(argv[i]));
             lval* x = builtin_load(e, args);
 
             if (x->type == LVAL_ERR)
-                lval_println(x);
+                lval_fprintln(ctx->out, x);
 
             lval_del(x);
         }
 
+    if (trace && ctx->trace)
+    {
+        lval* x = ltrace_stop(ctx);
+
+        if (x->type == LVAL_ERR)
+            lval_fprintln(stderr, x);
+
+        lval_del(x);
+    }
+
+    if (profile && ctx->prof)
+    {
+        lval* x = lprof_stop(ctx, profile, stderr);
+
+        if (x->type == LVAL_ERR)
+            lval_fprintln(stderr, x);
+
+        lval_del(x);
+    }
+
+    /// The files given are loaded once up front and stay
+    /// warm for every request.
+    if (serve)
+    {
+        lval* x;
+
+        if (workers > 0)
+            x = lprefork_serve(ctx, socket, workers, max_requests, max_rss);
+        else
+            x = socket ? lserve_socket(ctx, socket) : lserve_stream(ctx, stdin, stdout);
+
+        if (x->type == LVAL_ERR)
+            lval_fprintln(stderr, x);
+
+        lval_del(x);
+    }
+
     lval_del(p);
-    lenv_del(e);
+    lctx_del(ctx);
+
+    if (heap_report)
+        lheap_report(stderr);
 
     return 0;
 }
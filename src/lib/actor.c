@@ -0,0 +1,244 @@
+#include <actor.h>
+#include <ctx.h>
+#include <lenv.h>
+#include <lval.h>
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+
+///////////////////////
+/// `lmbox` Methods ///
+///////////////////////
+
+static void lmbox_init(lmbox* b)
+{
+    b->stub.next = NULL;
+    b->stub.val = NULL;
+    b->head = &b->stub;
+    b->tail = &b->stub;
+    b->count = 0;
+}
+
+
+static void lmbox_link(lmbox* b, lmsg* m)
+{
+    m->next = NULL;
+    lmsg* prev = atomic_exchange(&b->head, m);
+    prev->next = m;
+}
+
+
+/// Queues `v` and returns the number of queued messages.
+static int lmbox_push(lmbox* b, lval* v)
+{
+    lmsg* m = malloc(sizeof(lmsg));
+    m->val = v;
+
+    int count = ++b->count;
+    lmbox_link(b, m);
+    return count;
+}
+
+
+/// Takes the oldest message. Returns NULL if the queue is
+/// empty or a sender is midway through linking the next
+/// message in. Only one thread may pop at a time.
+static lval* lmbox_pop(lmbox* b)
+{
+    lmsg* tail = b->tail;
+    lmsg* next = tail->next;
+
+    if (tail == &b->stub)
+    {
+        if (next == NULL)
+            return NULL;
+
+        b->tail = next;
+        tail = next;
+        next = next->next;
+    }
+
+    if (next == NULL)
+    {
+        if (tail != b->head)
+            return NULL;
+
+        lmbox_link(b, &b->stub);
+        next = tail->next;
+
+        if (next == NULL)
+            return NULL;
+    }
+
+    b->tail = next;
+    b->count--;
+
+    lval* v = tail->val;
+    free(tail);
+    return v;
+}
+
+
+static void lmbox_clear(lmbox* b)
+{
+    lval* v;
+
+    while ((v = lmbox_pop(b)))
+        lval_del(v);
+}
+
+
+///////////////////////////
+/// `lactor` Scheduling ///
+///////////////////////////
+
+static void lactor_run(void* arg);
+
+
+static void lactor_release(void* arg)
+{
+    lactor_unref(arg);
+}
+
+
+/// Queues a turn of `a` unless one is already pending.
+static void lactor_schedule(lactor* a)
+{
+    int idle = 0;
+
+    if (atomic_compare_exchange_strong(&a->scheduled, &idle, 1))
+        lpool_submit(lctx_pool(&a->ctx), &a->runs, lactor_run, 
+                     lactor_release, lactor_ref(a));
+}
+
+
+static void lactor_run(void* arg)
+{
+    lactor* a = arg;
+
+    for (int i = 0; i < LACTOR_BATCH; i++)
+    {
+        lval* v = lmbox_pop(&a->inbox);
+
+        if (v == NULL)
+            break;
+
+        lval* r = lval_apply(a->env, a->behaviour, lval_add(lval_sexpr(), v));
+        a->processed++;
+
+        if (r->type == LVAL_ERR)
+            a->errors++;
+
+        if (r->type == LVAL_SEXPR && r->count == 0)
+            lval_del(r);
+        else
+            lmbox_push(&a->outbox, r);
+    }
+
+    a->scheduled = 0;
+
+    if (a->inbox.count > 0)
+        lactor_schedule(a);
+}
+
+
+/////////////////////////////
+/// `lactor` Constructors ///
+/////////////////////////////
+
+lactor* lactor_new(lenv* e, lval* f)
+{
+    lactor* a = malloc(sizeof(lactor));
+    a->refs = 1;
+    a->behaviour = f;
+
+    lctx_fork(e->ctx, &a->ctx);
+    a->env = lenv_snapshot(e);
+    a->env->ctx = &a->ctx;
+
+    lmbox_init(&a->inbox);
+    lmbox_init(&a->outbox);
+
+    a->runs.pending = 0;
+    a->scheduled = 0;
+    a->receiving = 0;
+
+    a->sent = 0;
+    a->processed = 0;
+    a->received = 0;
+    a->errors = 0;
+    a->peak = 0;
+
+    return a;
+}
+
+
+lactor* lactor_ref(lactor* a)
+{
+    a->refs++;
+    return a;
+}
+
+
+void lactor_unref(lactor* a)
+{
+    if (--a->refs > 0)
+        return;
+
+    lmbox_clear(&a->inbox);
+    lmbox_clear(&a->outbox);
+
+    lenv_del(a->env);
+    lval_del(a->behaviour);
+    free(a);
+}
+
+
+////////////////////////
+/// `lactor` Methods ///
+////////////////////////
+
+void lactor_send(lactor* a, lval* v)
+{
+    int depth = lmbox_push(&a->inbox, v);
+    int peak = a->peak;
+
+    while (depth > peak && !atomic_compare_exchange_weak(&a->peak, &peak, depth))
+        ;
+
+    a->sent++;
+    lactor_schedule(a);
+}
+
+
+lval* lactor_receive(lactor* a, int wait_all)
+{
+    int idle = 0;
+
+    if (!atomic_compare_exchange_strong(&a->receiving, &idle, 1))
+        return lval_err("Actor is already being received from.");
+
+    lval* x = lmbox_pop(&a->outbox);
+
+    if (x == NULL)
+    {
+        lpool_wait(lctx_pool(&a->ctx), &a->runs);
+        x = lmbox_pop(&a->outbox);
+    }
+
+    if (x == NULL && wait_all)
+    {
+        lpool* p = lctx_pool(&a->ctx);
+        lpool_wait(p, &p->all);
+        x = lmbox_pop(&a->outbox);
+    }
+
+    a->receiving = 0;
+
+    if (x == NULL)
+        return lval_err("Actor has no result to receive.");
+
+    a->received++;
+    return x;
+}
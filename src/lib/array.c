@@ -0,0 +1,179 @@
+#include <array.h>
+#include <future.h>
+#include <generator.h>
+#include <hamt.h>
+#include <lval.h>
+
+#include <stdlib.h>
+
+
+///////////////////////////
+/// `larr` Constructors ///
+///////////////////////////
+
+larr* larr_new(int cap)
+{
+    larr* a = malloc(sizeof(larr));
+    a->refs = 1;
+    a->count = 0;
+    a->cap = cap;
+    a->items = cap ? malloc(sizeof(lval*) * cap) : NULL;
+    return a;
+}
+
+
+larr* larr_ref(larr* a)
+{
+    a->refs++;
+    return a;
+}
+
+
+void larr_unref(larr* a)
+{
+    if (--a->refs > 0)
+        return;
+
+    for (int i = 0; i < a->count; i++)
+        lval_del(a->items[i]);
+
+    free(a->items);
+    free(a);
+}
+
+
+//////////////////////
+/// `larr` Methods ///
+//////////////////////
+
+void larr_push(larr* a, lval* x)
+{
+    if (a->count == a->cap)
+    {
+        a->cap = a->cap ? a->cap * 2 : 8;
+        a->items = realloc(a->items, sizeof(lval*) * a->cap);
+    }
+
+    a->items[a->count++] = x;
+}
+
+
+lval* larr_freeze(larr* a)
+{
+    lval* q = lval_qexpr();
+    q->count = a->count;
+    q->cell = malloc(sizeof(lval*) * a->count);
+
+    for (int i = 0; i < a->count; i++)
+        q->cell[i] = lval_copy(a->items[i]);
+
+    return q;
+}
+
+
+struct larr_reaches_data
+{
+    larr* a;
+    int found;
+};
+
+
+static void larr_reaches_entry(lhent* x, void* data)
+{
+    struct larr_reaches_data* d = data;
+
+    if (!d->found)
+        d->found = larr_reaches(x->key, d->a) || (x->val && larr_reaches(x->val, d->a));
+}
+
+
+static void larr_reaches_visit(lval* x, void* data)
+{
+    struct larr_reaches_data* d = data;
+
+    if (!d->found)
+        d->found = larr_reaches(x, d->a);
+}
+
+
+int larr_reaches(lval* v, larr* a)
+{
+    switch (v->type)
+    {
+        case LVAL_ARR:
+            if (v->arr == a)
+                return 1;
+
+            for (int i = 0; i < v->arr->count; i++)
+                if (larr_reaches(v->arr->items[i], a))
+                    return 1;
+
+            return 0;
+
+        case LVAL_QEXPR:
+        case LVAL_SEXPR:
+        case LVAL_RECUR:
+            for (int i = 0; i < v->count; i++)
+                if (larr_reaches(v->cell[i], a))
+                    return 1;
+
+            return 0;
+
+        case LVAL_MAP:
+        case LVAL_SET:
+        {
+            struct larr_reaches_data d = { a, 0 };
+            lhamt_each(v->hamt, larr_reaches_entry, &d);
+            return d.found;
+        }
+
+        /// The source and function of every stage.
+        case LVAL_SEQ:
+            for (lseq* s = v->seq; s; s = s->inner)
+                if ((s->src && larr_reaches(s->src, a)) || (s->func && larr_reaches(s->func, a)))
+                    return 1;
+
+            return 0;
+
+        case LVAL_GEN:
+        {
+            struct larr_reaches_data d = { a, 0 };
+            lgen_each(v->gen, larr_reaches_visit, &d);
+            return d.found;
+        }
+
+        /// What it settles on, so waits for it if need be.
+        case LVAL_FUT:
+            return larr_reaches(lfut_result(v->fut), a);
+
+        /// Arguments already bound by partial application.
+        case LVAL_FUN:
+            if (v->builtin)
+                return 0;
+
+            for (int i = 0; i < v->env->count; i++)
+                if (larr_reaches(v->env->vals[i], a))
+                    return 1;
+
+            return 0;
+
+        default:
+            return 0;
+    }
+}
+
+
+larr* larr_thaw(lval* q)
+{
+    larr* a = malloc(sizeof(larr));
+    a->refs = 1;
+    a->count = q->count;
+    a->cap = q->count;
+    a->items = q->cell;
+
+    q->count = 0;
+    q->cell = NULL;
+    lval_del(q);
+
+    return a;
+}
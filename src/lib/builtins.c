@@ -1,10 +1,26 @@
 #include <builtins.h>
+#include <actor.h>
+#include <array.h>
+#include <ctx.h>
+#include <future.h>
+#include <generator.h>
+#include <hamt.h>
+#include <heap.h>
 #include <io.h>
+#include <loop.h>
 #include <macros.h>
+#include <module.h>
+#include <parallel.h>
 #include <parser.h>
+#include <pool.h>
+#include <seq.h>
+#include <sort.h>
+#include <trace.h>
 #include <types.h>
 #include <utilities.h>
+#include <writer.h>
 
+#include <limits.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -146,7 +162,7 @@ lval* builtin_tail(lenv* e, lval* a)
 
 lval* builtin_list(lenv* e, lval* a)
 {
-    a->type = LVAL_QEXPR;
+    LHEAP_RETYPE(a, LVAL_QEXPR);
     return a;
 }
 
@@ -157,7 +173,7 @@ lval* builtin_eval(lenv* e, lval* a)
     LASSERT(a, a->cell[0]->type == LVAL_QEXPR, "Function 'eval' passed incorrect type!");
 
     lval* x = lval_take(a, 0);
-    x->type = LVAL_SEXPR;
+    LHEAP_RETYPE(x, LVAL_SEXPR);
     return lval_eval(e, x);
 }
 
@@ -180,6 +196,1026 @@ lval* builtin_join(lenv* e, lval* a)
 }
 
 
+//////////////////////////////////
+/// Builtin Sequence Operators ///
+//////////////////////////////////
+
+lval* builtin_range(lenv* e, lval* a)
+{
+    LASSERT(a, a->count >= 1 && a->count <= 3,
+            "Function 'range' passed incorrect number of arguments. "
+            "Got %i, Expected 1 to 3.", a->count);
+
+    for (int i = 0; i < a->count; i++)
+        LASSERT_TYPE("range", a, i, LVAL_NUM);
+
+    long start = (a->count == 1) ? 0 : a->cell[0]->num;
+    long end = (a->count == 1) ? a->cell[0]->num : a->cell[1]->num;
+    long step = (a->count == 3) ? a->cell[2]->num : 1;
+
+    LASSERT(a, step != 0, "Function 'range' passed a step of 0.");
+
+    lval_del(a);
+    return lval_seq(lseq_range(start, end, step));
+}
+
+
+lval* builtin_seq(lenv* e, lval* a)
+{
+    LASSERT_NUM("seq", a, 1);
+    LASSERT_SEQ("seq", a, 0);
+
+    lval* x = lval_seq(lseq_of(a->cell[0]));
+    lval_del(a);
+    return x;
+}
+
+
+static lval* builtin_seq_stage(lenv* e, lval* a, char* func, int kind)
+{
+    int expect = (kind == LSEQ_TAKE) ? LVAL_NUM : LVAL_FUN;
+
+    LASSERT_NUM(func, a, 2);
+    LASSERT_TYPE(func, a, 0, expect);
+    LASSERT_SEQ(func, a, 1);
+
+    lseq* inner = lseq_of(a->cell[1]);
+    lval* f = lval_pop(a, 0);
+    long n = 0;
+
+    if (kind == LSEQ_TAKE)
+    {
+        n = f->num;
+        lval_del(f);
+        f = NULL;
+    }
+
+    lval_del(a);
+    return lval_seq(lseq_stage(kind, f, n, inner));
+}
+
+
+lval* builtin_seq_map(lenv* e, lval* a)
+{
+    return builtin_seq_stage(e, a, "seq-map", LSEQ_MAP);
+}
+
+
+lval* builtin_seq_filter(lenv* e, lval* a)
+{
+    return builtin_seq_stage(e, a, "seq-filter", LSEQ_FILTER);
+}
+
+
+lval* builtin_seq_take(lenv* e, lval* a)
+{
+    return builtin_seq_stage(e, a, "seq-take", LSEQ_TAKE);
+}
+
+
+lval* builtin_seq_take_while(lenv* e, lval* a)
+{
+    return builtin_seq_stage(e, a, "seq-take-while", LSEQ_TAKE_WHILE);
+}
+
+
+lval* builtin_fold(lenv* e, lval* a)
+{
+    LASSERT_NUM("fold", a, 3);
+    LASSERT_TYPE("fold", a, 0, LVAL_FUN);
+    LASSERT_SEQ("fold", a, 2);
+
+    lseq* s = lseq_of(a->cell[2]);
+    lval* f = lval_pop(a, 0);
+    lval* acc = lval_pop(a, 0);
+    lval_del(a);
+
+    lseq_iter* it = lseq_iter_new(s);
+    lval* x;
+
+    while (acc->type != LVAL_ERR && (x = lseq_iter_next(e, it)))
+    {
+        if (x->type == LVAL_ERR)
+        {
+            lval_del(acc);
+            acc = x;
+            break;
+        }
+
+        lval* args = lval_add(lval_add(lval_sexpr(), acc), x);
+        acc = lval_apply(e, f, args);
+    }
+
+    lseq_iter_del(it);
+    lseq_unref(s);
+    lval_del(f);
+    return acc;
+}
+
+
+lval* builtin_collect(lenv* e, lval* a)
+{
+    LASSERT_NUM("collect", a, 1);
+    LASSERT_SEQ("collect", a, 0);
+
+    lseq* s = lseq_of(a->cell[0]);
+    lval_del(a);
+
+    lseq_iter* it = lseq_iter_new(s);
+    lval* q = lval_qexpr();
+    lval* x;
+
+    while ((x = lseq_iter_next(e, it)))
+    {
+        if (x->type == LVAL_ERR)
+        {
+            lval_del(q);
+            q = x;
+            break;
+        }
+
+        lval_add(q, x);
+    }
+
+    lseq_iter_del(it);
+    lseq_unref(s);
+    return q;
+}
+
+
+///////////////////////////////
+/// Builtin Array Operators ///
+///////////////////////////////
+
+lval* builtin_make_array(lenv* e, lval* a)
+{
+    LASSERT(a, a->count == 1 || a->count == 2,
+            "Function 'make-array' passed incorrect number of arguments. "
+            "Got %i, Expected 1 or 2.", a->count);
+    LASSERT_TYPE("make-array", a, 0, LVAL_NUM);
+    LASSERT(a, a->cell[0]->num >= 0,
+            "Function 'make-array' passed negative size %li.",
+            a->cell[0]->num);
+    LASSERT(a, a->cell[0]->num <= INT_MAX,
+            "Function 'make-array' passed size %li, larger than the "
+            "most items an Array holds (%i).", a->cell[0]->num, INT_MAX);
+
+    lval* fill = (a->count == 2) ? lval_pop(a, 1) : lval_num(0);
+    larr* arr = larr_new(a->cell[0]->num);
+
+    for (long i = 0; i < a->cell[0]->num; i++)
+        larr_push(arr, lval_copy(fill));
+
+    lval_del(fill);
+    lval_del(a);
+    return lval_arr(arr);
+}
+
+
+/// Checks that argument 1 of `a` indexes into the array at argument 0.
+static lval* builtin_array_index(lval* a, char* func)
+{
+    LASSERT_TYPE(func, a, 0, LVAL_ARR);
+    LASSERT_TYPE(func, a, 1, LVAL_NUM);
+    LASSERT(a, a->cell[1]->num >= 0 && a->cell[1]->num < a->cell[0]->arr->count,
+            "Function '%s' passed index %li out of bounds for an Array "
+            "of %i items.", func, a->cell[1]->num, a->cell[0]->arr->count);
+
+    return NULL;
+}
+
+
+lval* builtin_aget(lenv* e, lval* a)
+{
+    LASSERT_NUM("aget", a, 2);
+
+    lval* err = builtin_array_index(a, "aget");
+    if (err)
+        return err;
+
+    lval* x = lval_copy(a->cell[0]->arr->items[a->cell[1]->num]);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_aset(lenv* e, lval* a)
+{
+    LASSERT_NUM("aset!", a, 3);
+
+    lval* err = builtin_array_index(a, "aset!");
+    if (err)
+        return err;
+
+    larr* arr = a->cell[0]->arr;
+    long i = a->cell[1]->num;
+
+    LASSERT(a, !larr_reaches(a->cell[2], arr),
+            "Function 'aset!' cannot store an Array inside itself.");
+
+    lval_del(arr->items[i]);
+    arr->items[i] = lval_pop(a, 2);
+
+    lval_del(a);
+    return lval_sexpr();
+}
+
+
+lval* builtin_push(lenv* e, lval* a)
+{
+    LASSERT_NUM("push!", a, 2);
+    LASSERT_TYPE("push!", a, 0, LVAL_ARR);
+    LASSERT(a, !larr_reaches(a->cell[1], a->cell[0]->arr),
+            "Function 'push!' cannot store an Array inside itself.");
+
+    larr_push(a->cell[0]->arr, lval_pop(a, 1));
+
+    lval_del(a);
+    return lval_sexpr();
+}
+
+
+lval* builtin_alen(lenv* e, lval* a)
+{
+    LASSERT_NUM("alen", a, 1);
+    LASSERT_TYPE("alen", a, 0, LVAL_ARR);
+
+    lval* x = lval_num(a->cell[0]->arr->count);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_freeze(lenv* e, lval* a)
+{
+    LASSERT_NUM("freeze", a, 1);
+    LASSERT_TYPE("freeze", a, 0, LVAL_ARR);
+
+    lval* x = larr_freeze(a->cell[0]->arr);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_thaw(lenv* e, lval* a)
+{
+    LASSERT_NUM("thaw", a, 1);
+    LASSERT_TYPE("thaw", a, 0, LVAL_QEXPR);
+
+    return lval_arr(larr_thaw(lval_take(a, 0)));
+}
+
+
+//////////////////////////////
+/// Builtin Hash Operators ///
+//////////////////////////////
+
+#define LASSERT_HASH(func, args, index)                                     \
+  LASSERT(args, args->cell[index]->type == LVAL_MAP                         \
+             || args->cell[index]->type == LVAL_SET,                        \
+    "Function '%s' passed incorrect type for argument %i. "                 \
+    "Got %s, Expected %s or %s.",                                           \
+    func, index, ltype_name(args->cell[index]->type),                       \
+    ltype_name(LVAL_MAP), ltype_name(LVAL_SET))
+
+
+lval* builtin_hash_map(lenv* e, lval* a)
+{
+    LASSERT_NUM("hash-map", a, 1);
+    LASSERT_TYPE("hash-map", a, 0, LVAL_QEXPR);
+
+    lval* pairs = a->cell[0];
+
+    for (int i = 0; i < pairs->count; i++)
+        LASSERT(a, pairs->cell[i]->type == LVAL_QEXPR 
+                   && pairs->cell[i]->count == 2,
+                "Function 'hash-map' passed an invalid pair at index %i. "
+                "Expected a %s of a key and value.", i,
+                ltype_name(LVAL_QEXPR));
+
+    lhamt* root = NULL;
+    int count = 0;
+
+    while (pairs->count)
+    {
+        lval* pair = lval_pop(pairs, 0);
+        lval* k = lval_pop(pair, 0);
+        lval* v = lval_take(pair, 0);
+
+        int added;
+        lhamt* next = lhamt_insert(root, k, v, lval_hash(k), &added);
+        lhamt_unref(root);
+        root = next;
+        count += added;
+    }
+
+    lval_del(a);
+    return lval_map(root, count);
+}
+
+
+lval* builtin_hash_set(lenv* e, lval* a)
+{
+    LASSERT_NUM("hash-set", a, 1);
+    LASSERT_TYPE("hash-set", a, 0, LVAL_QEXPR);
+
+    lval* items = a->cell[0];
+    lhamt* root = NULL;
+    int count = 0;
+
+    while (items->count)
+    {
+        lval* k = lval_pop(items, 0);
+
+        int added;
+        lhamt* next = lhamt_insert(root, k, NULL, lval_hash(k), &added);
+        lhamt_unref(root);
+        root = next;
+        count += added;
+    }
+
+    lval_del(a);
+    return lval_set(root, count);
+}
+
+
+lval* builtin_insert(lenv* e, lval* a)
+{
+    LASSERT_HASH("insert", a, 0);
+
+    int is_map = a->cell[0]->type == LVAL_MAP;
+    int expect = is_map ? 3 : 2;
+
+    LASSERT_NUM("insert", a, expect);
+
+    lval* m = a->cell[0];
+    lval* k = lval_pop(a, 1);
+    lval* v = is_map ? lval_pop(a, 1) : NULL;
+
+    int added;
+    lhamt* root = lhamt_insert(m->hamt, k, v, lval_hash(k), &added);
+
+    lval* x = is_map ? lval_map(root, m->count + added) 
+                     : lval_set(root, m->count + added);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_remove(lenv* e, lval* a)
+{
+    LASSERT_NUM("remove", a, 2);
+    LASSERT_HASH("remove", a, 0);
+
+    lval* m = a->cell[0];
+
+    int removed;
+    lhamt* root = lhamt_remove(m->hamt, a->cell[1], lval_hash(a->cell[1]), &removed);
+
+    lval* x = (m->type == LVAL_MAP) ? lval_map(root, m->count - removed)
+                                    : lval_set(root, m->count - removed);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_get(lenv* e, lval* a)
+{
+    LASSERT(a, a->count == 2 || a->count == 3,
+            "Function 'get' passed incorrect number of arguments. "
+            "Got %i, Expected 2 or 3.", a->count);
+    LASSERT_TYPE("get", a, 0, LVAL_MAP);
+
+    lhent* x = lhamt_find(a->cell[0]->hamt, a->cell[1], lval_hash(a->cell[1]));
+
+    if (x)
+    {
+        lval* v = lval_copy(x->val);
+        lval_del(a);
+        return v;
+    }
+
+    if (a->count == 3)
+        return lval_take(a, 2);
+
+    lval_del(a);
+    return lval_err("Function 'get' could not find key.");
+}
+
+
+lval* builtin_contains(lenv* e, lval* a)
+{
+    LASSERT_NUM("contains", a, 2);
+    LASSERT_HASH("contains", a, 0);
+
+    int r = lhamt_find(a->cell[0]->hamt, a->cell[1], lval_hash(a->cell[1])) != NULL;
+    lval_del(a);
+    return lval_num(r);
+}
+
+
+lval* builtin_keys(lenv* e, lval* a)
+{
+    LASSERT_NUM("keys", a, 1);
+    LASSERT_HASH("keys", a, 0);
+
+    lval* x = lhamt_collect(a->cell[0]->hamt, LHAMT_KEYS);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_vals(lenv* e, lval* a)
+{
+    LASSERT_NUM("vals", a, 1);
+    LASSERT_TYPE("vals", a, 0, LVAL_MAP);
+
+    lval* x = lhamt_collect(a->cell[0]->hamt, LHAMT_VALS);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_size(lenv* e, lval* a)
+{
+    LASSERT_NUM("size", a, 1);
+    LASSERT_HASH("size", a, 0);
+
+    lval* x = lval_num(a->cell[0]->count);
+    lval_del(a);
+    return x;
+}
+
+
+/////////////////////////////////
+/// Builtin Sorting Operators ///
+/////////////////////////////////
+
+#define LASSERT_LIST(func, args, index)                                     \
+  LASSERT(args, args->cell[index]->type == LVAL_QEXPR                       \
+             || args->cell[index]->type == LVAL_ARR,                        \
+    "Function '%s' passed incorrect type for argument %i. "                 \
+    "Got %s, Expected %s or %s.",                                           \
+    func, index, ltype_name(args->cell[index]->type),                       \
+    ltype_name(LVAL_QEXPR), ltype_name(LVAL_ARR))
+
+
+/// Sorts the Q-Expression or a copy of the Array `v`, consuming `v`.
+static lval* builtin_sort_list(lenv* e, lval* f, lval* v)
+{
+    if (v->type == LVAL_ARR)
+    {
+        larr* arr = larr_new(v->arr->count);
+
+        for (int i = 0; i < v->arr->count; i++)
+            larr_push(arr, lval_copy(v->arr->items[i]));
+
+        lval_del(v);
+        v = lval_arr(arr);
+    }
+
+    lval** items = (v->type == LVAL_ARR) ? v->arr->items : v->cell;
+    int n = (v->type == LVAL_ARR) ? v->arr->count : v->count;
+
+    lval* err = lsort(e, f, items, n);
+
+    if (err)
+    {
+        lval_del(v);
+        return err;
+    }
+
+    return v;
+}
+
+
+lval* builtin_sort(lenv* e, lval* a)
+{
+    LASSERT_NUM("sort", a, 1);
+    LASSERT_LIST("sort", a, 0);
+
+    return builtin_sort_list(e, NULL, lval_take(a, 0));
+}
+
+
+lval* builtin_sort_by(lenv* e, lval* a)
+{
+    LASSERT_NUM("sort-by", a, 2);
+    LASSERT_TYPE("sort-by", a, 0, LVAL_FUN);
+    LASSERT_LIST("sort-by", a, 1);
+
+    lval* f = lval_pop(a, 0);
+    lval* x = builtin_sort_list(e, f, lval_take(a, 0));
+    lval_del(f);
+    return x;
+}
+
+
+lval* builtin_binary_search(lenv* e, lval* a)
+{
+    LASSERT_NUM("binary-search", a, 2);
+    LASSERT_LIST("binary-search", a, 1);
+
+    lval* v = a->cell[1];
+    int i = (v->type == LVAL_ARR) 
+          ? lsort_search(v->arr->items, v->arr->count, a->cell[0])
+          : lsort_search(v->cell, v->count, a->cell[0]);
+
+    lval_del(a);
+    return lval_num(i);
+}
+
+
+//////////////////////////////////
+/// Builtin Parallel Operators ///
+//////////////////////////////////
+
+/// Runs `op` with the function at index 0 of `a` over the
+/// sequenceable at index `a->count - 1`, which is drained
+/// into a Q-Expression first unless it is already a list.
+static lval* builtin_parallel(lenv* e, lval* a, char* func, int op)
+{
+    int expect = (op == LPAR_REDUCE) ? 3 : 2;
+
+    LASSERT_NUM(func, a, expect);
+    LASSERT_TYPE(func, a, 0, LVAL_FUN);
+    LASSERT_SEQ(func, a, a->count - 1);
+
+    lval* v = lval_pop(a, a->count - 1);
+
+    if (v->type != LVAL_QEXPR && v->type != LVAL_ARR)
+    {
+        v = builtin_collect(e, lval_add(lval_sexpr(), v));
+
+        if (v->type == LVAL_ERR)
+        {
+            lval_del(a);
+            return v;
+        }
+    }
+
+    lval** items = (v->type == LVAL_ARR) ? v->arr->items : v->cell;
+    int n = (v->type == LVAL_ARR) ? v->arr->count : v->count;
+
+    lval* x = lparallel(e, a->cell[0], (op == LPAR_REDUCE) ? a->cell[1] : NULL, 
+                        items, n, op);
+
+    lval_del(v);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_pmap(lenv* e, lval* a)
+{
+    return builtin_parallel(e, a, "pmap", LPAR_MAP);
+}
+
+
+lval* builtin_pfilter(lenv* e, lval* a)
+{
+    return builtin_parallel(e, a, "pfilter", LPAR_FILTER);
+}
+
+
+lval* builtin_preduce(lenv* e, lval* a)
+{
+    return builtin_parallel(e, a, "preduce", LPAR_REDUCE);
+}
+
+
+lval* builtin_parallel_config(lenv* e, lval* a)
+{
+    LASSERT_NUM("parallel-config", a, 2);
+    LASSERT_TYPE("parallel-config", a, 0, LVAL_NUM);
+    LASSERT_TYPE("parallel-config", a, 1, LVAL_NUM);
+    LASSERT(a, e->ctx != NULL && e->ctx->owner == e->ctx,
+            "Function 'parallel-config' cannot be called from a task or generator.");
+    LASSERT(a, a->cell[0]->num >= 0 && a->cell[1]->num >= 0,
+            "Function 'parallel-config' passed negative worker or chunk count.");
+
+    lctx* c = e->ctx;
+    int workers = a->cell[0]->num ? (int)a->cell[0]->num : lix_cpu_count();
+
+    if (c->pool && c->pool->workers != workers)
+    {
+        lpool_del(c->pool);
+        c->pool = NULL;
+    }
+
+    c->workers = workers;
+    c->chunk = (int)a->cell[1]->num;
+
+    lval_del(a);
+    return lval_sexpr();
+}
+
+
+//////////////////////////////
+/// Builtin Task Operators ///
+//////////////////////////////
+
+lval* builtin_spawn(lenv* e, lval* a)
+{
+    LASSERT_NUM("spawn", a, 1);
+    LASSERT_TYPE("spawn", a, 0, LVAL_QEXPR);
+
+    lval* x = lval_take(a, 0);
+    LHEAP_RETYPE(x, LVAL_SEXPR);
+    return lval_fut(lfut_spawn(e, x));
+}
+
+
+lval* builtin_await(lenv* e, lval* a)
+{
+    LASSERT_NUM("await", a, 1);
+    LASSERT_TYPE("await", a, 0, LVAL_FUT);
+
+    lval* x = lfut_await(a->cell[0]->fut);
+    lval_del(a);
+    return x;
+}
+
+
+///////////////////////////////
+/// Builtin Actor Operators ///
+///////////////////////////////
+
+lval* builtin_actor(lenv* e, lval* a)
+{
+    LASSERT_NUM("actor", a, 1);
+    LASSERT_TYPE("actor", a, 0, LVAL_FUN);
+    LASSERT(a, e->ctx != NULL,
+            "Function 'actor' must be called within an interpreter instance.");
+
+    return lval_actor(lactor_new(e, lval_take(a, 0)));
+}
+
+
+lval* builtin_send(lenv* e, lval* a)
+{
+    LASSERT_NUM("send", a, 2);
+    LASSERT_TYPE("send", a, 0, LVAL_ACTOR);
+
+    lactor_send(a->cell[0]->actor, lval_pop(a, 1));
+    lval_del(a);
+    return lval_sexpr();
+}
+
+
+lval* builtin_receive(lenv* e, lval* a)
+{
+    LASSERT_NUM("receive", a, 1);
+    LASSERT_TYPE("receive", a, 0, LVAL_ACTOR);
+
+    int owner = e->ctx != NULL && e->ctx->owner == e->ctx;
+    lval* x = lactor_receive(a->cell[0]->actor, owner);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_actor_stats(lenv* e, lval* a)
+{
+    LASSERT_NUM("actor-stats", a, 1);
+    LASSERT_TYPE("actor-stats", a, 0, LVAL_ACTOR);
+
+    lactor* x = a->cell[0]->actor;
+    char* names[] = { "sent", "processed", "received", "errors", "queued", "peak" };
+    long stats[] = { x->sent, x->processed, x->received, x->errors, 
+                     x->inbox.count, x->peak };
+
+    lval* pairs = lval_qexpr();
+
+    for (int i = 0; i < 6; i++)
+        lval_add(pairs, lval_add(lval_add(lval_qexpr(), lval_str(names[i])), 
+                                 lval_num(stats[i])));
+
+    lval_del(a);
+    return builtin_hash_map(e, lval_add(lval_sexpr(), pairs));
+}
+
+
+///////////////////////////////////
+/// Builtin Generator Operators ///
+///////////////////////////////////
+
+lval* builtin_generator(lenv* e, lval* a)
+{
+    LASSERT_NUM("generator", a, 1);
+    LASSERT_TYPE("generator", a, 0, LVAL_QEXPR);
+    LASSERT(a, e->ctx != NULL,
+            "Function 'generator' must be called within an interpreter instance.");
+
+    lval* x = lval_take(a, 0);
+    LHEAP_RETYPE(x, LVAL_SEXPR);
+
+    lgen* g = lgen_new(e, x);
+
+    if (g == NULL)
+        return lval_err(LGEN_UNAVAILABLE);
+
+    return lval_gen(g);
+}
+
+
+lval* builtin_yield(lenv* e, lval* a)
+{
+    LASSERT_NUM("yield", a, 1);
+
+    return lgen_yield(e, lval_take(a, 0));
+}
+
+
+lval* builtin_next(lenv* e, lval* a)
+{
+    LASSERT(a, a->count == 1 || a->count == 2,
+            "Function 'next' passed incorrect number of arguments. "
+            "Got %i, Expected 1 or 2.", a->count);
+    LASSERT_TYPE("next", a, 0, LVAL_GEN);
+
+    lval* x = lgen_next(a->cell[0]->gen);
+
+    if (x == NULL && a->count == 2)
+        x = lval_pop(a, 1);
+    else if (x == NULL)
+        x = lval_err("Generator is exhausted.");
+
+    lval_del(a);
+    return x;
+}
+
+
+///////////////////////////////
+/// Builtin Event Operators ///
+///////////////////////////////
+
+/// Returns an error if `func` cannot use the event loop
+/// of the instance owning `e` from the calling thread.
+static lval* builtin_event_check(lenv* e, char* func)
+{
+    if (e->ctx == NULL)
+        return lval_err("Function '%s' must be called within an interpreter instance.", func);
+
+    lloop* l = lctx_loop(e->ctx);
+
+    if (l == NULL)
+        return lval_err("Function '%s' is not supported on this platform.", func);
+
+    if (!lloop_owned(l))
+        return lval_err("Function '%s' called from a thread other than "
+                        "the one running the event loop.", func);
+
+    return NULL;
+}
+
+
+#define LASSERT_EVENT(func, args)                                           \
+  do {                                                                      \
+    lval* err = builtin_event_check(e, func);                               \
+    if (err) { lval_del(args); return err; }                                \
+  } while (0)
+
+
+lval* builtin_io_open(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-open", a, 2);
+    LASSERT_TYPE("io-open", a, 0, LVAL_STR);
+    LASSERT_TYPE("io-open", a, 1, LVAL_STR);
+    LASSERT_EVENT("io-open", a);
+
+    lval* x = lloop_open(lctx_loop(e->ctx), a->cell[0]->str, a->cell[1]->str);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_io_listen(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-listen", a, 1);
+    LASSERT_TYPE("io-listen", a, 0, LVAL_STR);
+    LASSERT_EVENT("io-listen", a);
+
+    lval* x = lloop_listen(lctx_loop(e->ctx), a->cell[0]->str);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_io_connect(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-connect", a, 1);
+    LASSERT_TYPE("io-connect", a, 0, LVAL_STR);
+    LASSERT_EVENT("io-connect", a);
+
+    lval* x = lloop_connect(lctx_loop(e->ctx), a->cell[0]->str);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_io_close(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-close", a, 1);
+    LASSERT_TYPE("io-close", a, 0, LVAL_NUM);
+    LASSERT_EVENT("io-close", a);
+
+    lval* x = lloop_close(lctx_loop(e->ctx), (int)a->cell[0]->num);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_io_read(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-read", a, 2);
+    LASSERT_TYPE("io-read", a, 0, LVAL_NUM);
+    LASSERT_TYPE("io-read", a, 1, LVAL_FUN);
+    LASSERT_EVENT("io-read", a);
+
+    lval* x = lloop_read(lctx_loop(e->ctx), (int)a->cell[0]->num, lval_pop(a, 1));
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_io_accept(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-accept", a, 2);
+    LASSERT_TYPE("io-accept", a, 0, LVAL_NUM);
+    LASSERT_TYPE("io-accept", a, 1, LVAL_FUN);
+    LASSERT_EVENT("io-accept", a);
+
+    lval* x = lloop_accept(lctx_loop(e->ctx), (int)a->cell[0]->num, lval_pop(a, 1));
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_io_write(lenv* e, lval* a)
+{
+    LASSERT(a, a->count == 2 || a->count == 3,
+            "Function 'io-write' passed incorrect number of arguments. "
+            "Got %i, Expected 2 or 3.", a->count);
+    LASSERT_TYPE("io-write", a, 0, LVAL_NUM);
+    LASSERT_TYPE("io-write", a, 1, LVAL_STR);
+
+    if (a->count == 3)
+        LASSERT_TYPE("io-write", a, 2, LVAL_FUN);
+
+    LASSERT_EVENT("io-write", a);
+
+    lval* f = (a->count == 3) ? lval_pop(a, 2) : NULL;
+    lval* x = lloop_write(lctx_loop(e->ctx), (int)a->cell[0]->num, a->cell[1]->str, f);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_io_timer(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-timer", a, 2);
+    LASSERT_TYPE("io-timer", a, 0, LVAL_NUM);
+    LASSERT_TYPE("io-timer", a, 1, LVAL_FUN);
+    LASSERT_EVENT("io-timer", a);
+
+    lloop_timer(lctx_loop(e->ctx), a->cell[0]->num, lval_pop(a, 1));
+    lval_del(a);
+    return lval_sexpr();
+}
+
+
+lval* builtin_io_run(lenv* e, lval* a)
+{
+    LASSERT_NUM("io-run", a, 1);
+    LASSERT_TYPE("io-run", a, 0, LVAL_NUM);
+    LASSERT_EVENT("io-run", a);
+
+    lval* x = lloop_run(lctx_loop(e->ctx), e, a->cell[0]->num);
+    lval_del(a);
+    return x;
+}
+
+
+////////////////////////////////
+/// Builtin Module Operators ///
+////////////////////////////////
+
+lval* builtin_require(lenv* e, lval* a)
+{
+    LASSERT_NUM("require", a, 1);
+    LASSERT_TYPE("require", a, 0, LVAL_STR);
+    LASSERT(a, e->ctx != NULL,
+            "Function 'require' must be called within an interpreter instance.");
+
+    lval* err = NULL;
+    lmod* m = lmod_require(e, a->cell[0]->str, &err);
+    lval_del(a);
+
+    return m ? lval_mod(m) : err;
+}
+
+
+lval* builtin_import(lenv* e, lval* a)
+{
+    LASSERT_NUM("import", a, 2);
+    LASSERT_TYPE("import", a, 0, LVAL_QEXPR);
+    LASSERT_TYPE("import", a, 1, LVAL_STR);
+    LASSERT(a, a->cell[0]->count == 1 && a->cell[0]->cell[0]->type == LVAL_SYM,
+            "Function 'import' must be passed a single symbol to bind.");
+
+    lval* m = builtin_require(e, lval_add(lval_sexpr(), lval_pop(a, 1)));
+
+    if (m->type != LVAL_ERR)
+        lenv_def(e, a->cell[0]->cell[0], m);
+
+    lval_del(a);
+
+    if (m->type == LVAL_ERR)
+        return m;
+
+    lval_del(m);
+    return lval_sexpr();
+}
+
+
+lval* builtin_export(lenv* e, lval* a)
+{
+    LASSERT_NUM("export", a, 1);
+    LASSERT_TYPE("export", a, 0, LVAL_QEXPR);
+
+    for (int i = 0; i < a->cell[0]->count; i++)
+        LASSERT(a, a->cell[0]->cell[i]->type == LVAL_SYM,
+                "Function 'export' cannot export non-symbol. "
+                "Got %s, Expected %s.",
+                ltype_name(a->cell[0]->cell[i]->type), ltype_name(LVAL_SYM));
+
+    lmod* m = lmod_of(e);
+
+    LASSERT(a, m != NULL, "Function 'export' called outside of a module.");
+
+    lval* syms = lval_pop(a, 0);
+    lval_del(a);
+
+    if (m->exports == NULL)
+        m->exports = syms;
+    else
+    {
+        while (syms->count)
+            lval_add(m->exports, lval_pop(syms, 0));
+
+        lval_del(syms);
+    }
+
+    return lval_sexpr();
+}
+
+
+//////////////////////////////
+/// Builtin Heap Operators ///
+//////////////////////////////
+
+/// Adds the pair of `name` and `x` to the Q-Expression
+/// `pairs`, as builtin_hash_map takes them.
+static lval* builtin_heap_pair(lval* pairs, char* name, lval* x)
+{
+    return lval_add(pairs, lval_add(lval_add(lval_qexpr(), lval_str(name)), x));
+}
+
+
+lval* builtin_heap_stats(lenv* e, lval* a)
+{
+    LASSERT_NUM("heap-stats", a, 1);
+    LASSERT_TYPE("heap-stats", a, 0, LVAL_QEXPR);
+
+    lheap_stats s;
+
+    LASSERT(a, lheap_snapshot(&s),
+            "Function 'heap-stats' needs a build defining LIX_HEAP_STATS.");
+
+    lval_del(a);
+
+    lval* types = lval_qexpr();
+
+    for (int i = 0; i < LHEAP_TYPES; i++)
+        if (s.live[i] != 0)
+            builtin_heap_pair(types, ltype_name(i), lval_num(s.live[i]));
+
+    char* names[] = { "live", "peak", "allocated", "freed", "copies", 
+                      "copied-bytes", "env-copies", "env-bindings", "max-rss" };
+    long stats[] = { s.total, s.peak, s.allocated, s.freed, s.copies,
+                     s.copied, s.envs, s.bindings, s.rss };
+
+    lval* pairs = lval_qexpr();
+
+    for (int i = 0; i < 9; i++)
+        builtin_heap_pair(pairs, names[i], lval_num(stats[i]));
+
+    builtin_heap_pair(pairs, "types", builtin_hash_map(e, lval_add(lval_sexpr(), types)));
+    return builtin_hash_map(e, lval_add(lval_sexpr(), pairs));
+}
+
+
 //////////////////////////////////
 /// Builtin Function Operators ///
 //////////////////////////////////
@@ -215,6 +1251,8 @@ lval* builtin_var(lenv* e, lval* a, char* func)
 
     for (int i = 0; i < syms->count; ++i)
     {
+        lval_name(a->cell[i + 1], syms->cell[i]->sym);
+
         if (strcmp(func, "def") == 0)
             lenv_def(e, syms->cell[i], a->cell[i + 1]);
 
@@ -344,8 +1382,8 @@ lval* builtin_if(lenv* e, lval* a)
 
     lval* x;
 
-    a->cell[1]->type = LVAL_SEXPR;
-    a->cell[2]->type = LVAL_SEXPR;
+    LHEAP_RETYPE(a->cell[1], LVAL_SEXPR);
+    LHEAP_RETYPE(a->cell[2], LVAL_SEXPR);
 
     if (a->cell[0]->num)
         x = lval_eval(e, lval_pop(a, 1));
@@ -357,6 +1395,262 @@ lval* builtin_if(lenv* e, lval* a)
 }
 
 
+//////////////////////////////
+/// Builtin Loop Operators ///
+//////////////////////////////
+
+/// Evaluates a loop body in `e` without consuming it.
+/// Returns NULL on success or the error the body produced.
+static lval* builtin_loop_step(lenv* e, lval* body)
+{
+    lval* r = lval_eval_ref(e, body);
+
+    if (r->type == LVAL_ERR)
+        return r;
+
+    lval_del(r);
+    return NULL;
+}
+
+
+/// Unbinds the symbols `syms` from `e` itself for a loop to
+/// bind them, returning what they were bound to.
+static lval** builtin_loop_save(lenv* e, lval* syms)
+{
+    lval** saved = malloc(sizeof(lval*) * (syms->count + 1));
+
+    for (int i = 0; i < syms->count; i++)
+        saved[i] = lenv_take(e, syms->cell[i]);
+
+    return saved;
+}
+
+
+/// Rebinds the symbols `syms` in `e` to what they were
+/// bound to before a loop, freeing `saved`.
+static void builtin_loop_restore(lenv* e, lval* syms, lval** saved)
+{
+    /// In reverse, so a symbol listed twice ends as it began.
+    for (int i = syms->count - 1; i >= 0; i--)
+    {
+        lval* x = lenv_take(e, syms->cell[i]);
+
+        if (x)
+            lval_del(x);
+
+        if (saved[i])
+        {
+            lenv_put(e, syms->cell[i], saved[i]);
+            lval_del(saved[i]);
+        }
+    }
+
+    free(saved);
+}
+
+
+/// Checks that a loop was given a symbol list and body.
+static lval* builtin_loop_check(lval* a, char* func, int syms, int index)
+{
+    LASSERT_TYPE(func, a, 0, LVAL_QEXPR);
+    LASSERT_TYPE(func, a, index, LVAL_QEXPR);
+
+    for (int i = 0; i < a->cell[0]->count; i++)
+        LASSERT(a, (a->cell[0]->cell[i]->type == LVAL_SYM),
+                "Function '%s' cannot bind non-symbol. "
+                "Got %s, Expected %s.", func,
+                ltype_name(a->cell[0]->cell[i]->type),
+                ltype_name(LVAL_SYM));
+
+    LASSERT(a, syms < 0 || a->cell[0]->count == syms,
+            "Function '%s' passed incorrect number of symbols. "
+            "Got %i, Expected %i.", func, a->cell[0]->count, syms);
+
+    return NULL;
+}
+
+
+lval* builtin_loop(lenv* e, lval* a)
+{
+    LASSERT(a, a->count >= 2,
+            "Function 'loop' passed incorrect number of arguments. "
+            "Got %i, Expected at least 2.", a->count);
+
+    lval* err = builtin_loop_check(a, "loop", -1, a->count - 1);
+    if (err)
+        return err;
+
+    LASSERT(a, (a->cell[0]->count == a->count - 2),
+            "Function 'loop' passed incorrect number of values for symbols. "
+            "Got %i, Expected %i.", a->count - 2, a->cell[0]->count);
+
+    lval* syms = lval_pop(a, 0);
+    lval* body = lval_pop(a, a->count - 1);
+    LHEAP_RETYPE(body, LVAL_SEXPR);
+
+    lval** saved = builtin_loop_save(e, syms);
+
+    lval* r = a;
+    LHEAP_RETYPE(r, LVAL_RECUR);
+
+    if (e->ctx)
+        e->ctx->loops++;
+
+    while (r->type == LVAL_RECUR)
+    {
+        if (r->count != syms->count)
+        {
+            lval* x = lval_err("Function 'recur' passed incorrect number of "
+                               "arguments. Got %i, Expected %i.",
+                               r->count, syms->count);
+            lval_del(r);
+            r = x;
+            break;
+        }
+
+        for (int i = 0; i < syms->count; i++)
+            lenv_put(e, syms->cell[i], r->cell[i]);
+
+        lval_del(r);
+        r = lval_eval_ref(e, body);
+    }
+
+    if (e->ctx)
+        e->ctx->loops--;
+
+    builtin_loop_restore(e, syms, saved);
+    lval_del(syms);
+    lval_del(body);
+    return r;
+}
+
+
+lval* builtin_recur(lenv* e, lval* a)
+{
+    LASSERT(a, !e->ctx || e->ctx->loops > 0,
+            "Function 'recur' called outside of a 'loop'.");
+
+    LHEAP_RETYPE(a, LVAL_RECUR);
+    return a;
+}
+
+
+lval* builtin_while(lenv* e, lval* a)
+{
+    LASSERT_NUM("while", a, 2);
+    LASSERT_TYPE("while", a, 0, LVAL_QEXPR);
+    LASSERT_TYPE("while", a, 1, LVAL_QEXPR);
+
+    lval* cond = a->cell[0];
+    lval* body = a->cell[1];
+    LHEAP_RETYPE(cond, LVAL_SEXPR);
+    LHEAP_RETYPE(body, LVAL_SEXPR);
+
+    lval* err = NULL;
+
+    while (!err)
+    {
+        lval* c = lval_eval_ref(e, cond);
+
+        if (c->type == LVAL_ERR)
+        {
+            err = c;
+            break;
+        }
+
+        if (c->type != LVAL_NUM)
+        {
+            err = lval_err("Function 'while' condition returned incorrect "
+                           "type. Got %s, Expected %s.",
+                           ltype_name(c->type), ltype_name(LVAL_NUM));
+            lval_del(c);
+            break;
+        }
+
+        long t = c->num;
+        lval_del(c);
+
+        if (!t)
+            break;
+
+        err = builtin_loop_step(e, body);
+    }
+
+    lval_del(a);
+    return err ? err : lval_sexpr();
+}
+
+
+lval* builtin_for_each(lenv* e, lval* a)
+{
+    LASSERT_NUM("for-each", a, 3);
+    LASSERT_SEQ("for-each", a, 1);
+
+    lval* err = builtin_loop_check(a, "for-each", 1, 2);
+    if (err)
+        return err;
+
+    lval* sym = a->cell[0]->cell[0];
+    lval* body = a->cell[2];
+    LHEAP_RETYPE(body, LVAL_SEXPR);
+
+    lval** saved = builtin_loop_save(e, a->cell[0]);
+
+    lseq* s = lseq_of(a->cell[1]);
+    lseq_iter* it = lseq_iter_new(s);
+    lval* x;
+
+    while (!err && (x = lseq_iter_next(e, it)))
+    {
+        if (x->type == LVAL_ERR)
+        {
+            err = x;
+            break;
+        }
+
+        lenv_put(e, sym, x);
+        lval_del(x);
+
+        err = builtin_loop_step(e, body);
+    }
+
+    lseq_iter_del(it);
+    lseq_unref(s);
+    builtin_loop_restore(e, a->cell[0], saved);
+    lval_del(a);
+    return err ? err : lval_sexpr();
+}
+
+
+lval* builtin_dotimes(lenv* e, lval* a)
+{
+    LASSERT_NUM("dotimes", a, 3);
+    LASSERT_TYPE("dotimes", a, 1, LVAL_NUM);
+
+    lval* err = builtin_loop_check(a, "dotimes", 1, 2);
+    if (err)
+        return err;
+
+    lval* sym = a->cell[0]->cell[0];
+    lval* body = a->cell[2];
+    LHEAP_RETYPE(body, LVAL_SEXPR);
+
+    lval** saved = builtin_loop_save(e, a->cell[0]);
+    lval* i = lval_num(0);
+
+    for (; !err && i->num < a->cell[1]->num; i->num++)
+    {
+        lenv_put(e, sym, i);
+        err = builtin_loop_step(e, body);
+    }
+
+    lval_del(i);
+    builtin_loop_restore(e, a->cell[0], saved);
+    lval_del(a);
+    return err ? err : lval_sexpr();
+}
+
+
 ////////////////////////////
 /// Builtin IO functions ///
 ////////////////////////////
@@ -366,60 +1660,102 @@ lval* builtin_load(lenv* e, lval* a)
     LASSERT_NUM("load", a, 1);
     LASSERT_TYPE("load", a, 0, LVAL_STR);
 
-    FILE* f = fopen(a->cell[0]->str, "rb");
+    lsrc* src = lsrc_open(a->cell[0]->str);
 
-    if (f == NULL)
+    if (src == NULL)
     {
         lval* err = lval_err("Could not load library %s", a->cell[0]->str);
         lval_del(a);
         return err;
     }
 
-    fseek(f, 0, SEEK_END);
-    long length = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    char* input = calloc(length + 1, 1);
-    fread(input, 1, length, f);
-    fclose(f);
+    if (e->ctx)
+        lsrc_parallel(src, e->ctx);
 
-    int pos = 0;
-    lval* expr = lval_read_expr(input, &pos, '\0');
-    free(input);
+    ltrace* t = e->ctx ? e->ctx->trace : NULL;
 
-    if (expr->type != LVAL_ERR)
-        while (expr->count)
+    if (t)
+        ltrace_begin(t, "load", a->cell[0]->str);
+
+    lval* expr;
+    lval* err = NULL;
+
+    while ((expr = lsrc_next(src)))
+    {
+        /// A form that cannot be parsed leaves nothing
+        /// reliable to read after it.
+        if (expr->type == LVAL_ERR)
         {
-            lval* x = lval_eval(e, lval_pop(expr, 0));
-            if (x->type == LVAL_ERR)
-                lval_println(x);
-            
-            lval_del(x);
+            err = expr;
+            break;
         }
-    else
-        lval_println(expr);
 
-    lval_del(expr);
+        if (t)
+            ltrace_form(t, expr);
+
+        lval* x = lval_eval(e, expr);
+
+        if (t)
+            ltrace_end(t, "form");
+
+        if (x->type == LVAL_ERR)
+            lval_fprintln(lctx_out(e), x);
+
+        lval_del(x);
+    }
+
+    if (t)
+        ltrace_end(t, "load");
+
+    lsrc_close(src);
     lval_del(a);
 
-    return lval_sexpr();
+    return err ? err : lval_sexpr();
 }
 
 
 lval* builtin_print(lenv* e, lval* a)
 {
+    lwriter* w = lwriter_file(lctx_out(e));
+
     for (int i = 0; i < a->count; ++i)
     {
-        lval_print(a->cell[i]);
-        putchar(' ');
+        lval_write(w, a->cell[i]);
+        lwriter_putc(w, ' ');
     }
 
-    putchar('\n');
+    lwriter_putc(w, '\n');
+    lwriter_close(w);
     lval_del(a);
 
     return lval_sexpr();
 }
 
 
+lval* builtin_show(lenv* e, lval* a)
+{
+    LASSERT_NUM("show", a, 1);
+
+    char* s = lval_show(a->cell[0]);
+    lval* x = lval_str(s);
+
+    free(s);
+    lval_del(a);
+    return x;
+}
+
+
+lval* builtin_to_string(lenv* e, lval* a)
+{
+    LASSERT_NUM("to-string", a, 1);
+
+    if (a->cell[0]->type == LVAL_STR)
+        return lval_take(a, 0);
+
+    return builtin_show(e, a);
+}
+
+
 /// TODO
 // lval* builtin_input(lenv* e, lval* a);
 
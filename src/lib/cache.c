@@ -0,0 +1,687 @@
+/// realpath and opendir are POSIX interfaces.
+#define _XOPEN_SOURCE 700
+
+#include <cache.h>
+#include <lenv.h>
+#include <lval.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif  /// _WIN32
+
+#define LCACHE_MAGIC "LIXC"
+#define LCACHE_PATH_SIZE 4096
+#define LCACHE_NAME_SIZE 32
+#define LCACHE_FNV_OFFSET 14695981039346656037ull
+#define LCACHE_FNV_PRIME 1099511628211ull
+
+
+/// Tags of the encoded forms. Every entry ends with
+/// LCACHE_END so a truncated entry is never mistaken
+/// for a complete one.
+enum
+{
+    LCACHE_END = 'E',
+    LCACHE_NUM = 'N',
+    LCACHE_SYM = 'Y',
+    LCACHE_STR = 'S',
+    LCACHE_SEXPR = '(',
+    LCACHE_QEXPR = '{',
+    LCACHE_LAMBDA = '\\',
+    LCACHE_BUILTIN = 'B'
+};
+
+
+////////////////
+/// Encoding ///
+////////////////
+
+/// Integers are written seven bits at a time, least
+/// significant first, with the top bit set on every byte
+/// but the last. Lengths and counts mostly fit in one.
+static void lcache_put_uint(FILE* f, uint64_t x)
+{
+    for (; x >= 0x80; x >>= 7)
+        putc((int)(x & 0x7f) | 0x80, f);
+
+    putc((int)x, f);
+}
+
+
+static int lcache_get_uint(lcache* c, uint64_t* x)
+{
+    *x = 0;
+
+    for (int shift = 0; c->pos < c->len && shift < 64; shift += 7)
+    {
+        unsigned char b = (unsigned char)c->data[c->pos++];
+        *x |= (uint64_t)(b & 0x7f) << shift;
+
+        if (!(b & 0x80))
+            return 1;
+    }
+
+    return 0;
+}
+
+
+/// Numbers are zig-zag encoded so small negative
+/// numbers stay short too.
+static void lcache_put_num(FILE* f, long x)
+{
+    uint64_t u = (uint64_t)x;
+    lcache_put_uint(f, (x < 0) ? ~(u << 1) : (u << 1));
+}
+
+
+static long lcache_num(uint64_t u)
+{
+    return (long)((u & 1) ? ~(u >> 1) : (u >> 1));
+}
+
+
+static void lcache_put_str(FILE* f, char* s)
+{
+    size_t n = strlen(s);
+    lcache_put_uint(f, n);
+    fwrite(s, 1, n, f);
+}
+
+
+/// Reads a string written by lcache_put_str, leaving
+/// it in place in the entry. Returns its length or -1.
+static long lcache_get_str(lcache* c, char** s)
+{
+    uint64_t n;
+
+    if (!lcache_get_uint(c, &n) || n > (uint64_t)(c->len - c->pos))
+        return -1;
+
+    *s = c->data + c->pos;
+    c->pos += (long)n;
+    return (long)n;
+}
+
+
+static lcache* lcache_new(char* path, char* tmp)
+{
+    lcache* c = malloc(sizeof(lcache));
+    c->file = NULL;
+    c->data = NULL;
+    c->len = 0;
+    c->pos = 0;
+    c->mapped = 0;
+    c->env = NULL;
+    c->path = strcpy(malloc(strlen(path) + 1), path);
+    c->tmp = tmp ? strcpy(malloc(strlen(tmp) + 1), tmp) : NULL;
+    return c;
+}
+
+
+///////////////
+/// Entries ///
+///////////////
+
+#ifndef _WIN32
+
+/// Identifies the source `src` by its absolute path and
+/// finds where its entry lives. Returns 0 if `src` is not
+/// a regular file or there is nowhere to keep the entry.
+static int lcache_locate(char* src, char* real, char* entry, struct stat* st)
+{
+    char* home = getenv("HOME");
+
+    if (home == NULL || realpath(src, real) == NULL)
+        return 0;
+
+    if (stat(real, st) != 0 || !S_ISREG(st->st_mode))
+        return 0;
+
+    uint64_t h = LCACHE_FNV_OFFSET;
+
+    for (char* c = real; *c; c++)
+        h = (h ^ (unsigned char)*c) * LCACHE_FNV_PRIME;
+
+    int n = snprintf(entry, LCACHE_PATH_SIZE, "%s/.lix/cache/%016llx.lxc",
+                     home, (unsigned long long)h);
+    return n < LCACHE_PATH_SIZE;
+}
+
+
+static void lcache_header(FILE* f, char* real, struct stat* st)
+{
+    fputs(LCACHE_MAGIC, f);
+    lcache_put_uint(f, LCACHE_FORMAT);
+    lcache_put_str(f, LIX_VERSION);
+    lcache_put_str(f, real);
+    lcache_put_uint(f, (uint64_t)st->st_size);
+    lcache_put_uint(f, (uint64_t)st->st_mtim.tv_sec);
+    lcache_put_uint(f, (uint64_t)st->st_mtim.tv_nsec);
+}
+
+
+static int lcache_match(lcache* c, char* s)
+{
+    char* x;
+    long n = lcache_get_str(c, &x);
+    return n == (long)strlen(s) && memcmp(x, s, n) == 0;
+}
+
+
+static int lcache_match_uint(lcache* c, uint64_t expect)
+{
+    uint64_t x;
+    return lcache_get_uint(c, &x) && x == expect;
+}
+
+
+/// Checks the header of an entry against the source it
+/// is meant to hold.
+static int lcache_check(lcache* c, char* real, struct stat* st)
+{
+    if (c->len < 5 || memcmp(c->data, LCACHE_MAGIC, 4) != 0)
+        return 0;
+
+    /// Entries are renamed into place complete, but one
+    /// cut short on disk must not be half evaluated.
+    if (c->data[c->len - 1] != LCACHE_END)
+        return 0;
+
+    c->pos = 4;
+
+    return lcache_match_uint(c, LCACHE_FORMAT)
+        && lcache_match(c, LIX_VERSION)
+        && lcache_match(c, real)
+        && lcache_match_uint(c, (uint64_t)st->st_size)
+        && lcache_match_uint(c, (uint64_t)st->st_mtim.tv_sec)
+        && lcache_match_uint(c, (uint64_t)st->st_mtim.tv_nsec);
+}
+
+
+/// Creates `~/.lix/cache` if it does not exist yet.
+static void lcache_mkdir(char* entry)
+{
+    char dir[LCACHE_PATH_SIZE];
+    strcpy(dir, entry);
+
+    char* cache = strrchr(dir, '/');
+    *cache = '\0';
+
+    char* lix = strrchr(dir, '/');
+    *lix = '\0';
+    mkdir(dir, 0755);
+
+    *lix = '/';
+    mkdir(dir, 0755);
+}
+
+
+/// An entry found by lcache_sweep.
+typedef struct lcache_file
+{
+    char name[LCACHE_NAME_SIZE];
+    time_t mtime;
+    long size;
+} lcache_file;
+
+
+static int lcache_file_cmp(const void* a, const void* b)
+{
+    time_t x = ((const lcache_file*)a)->mtime;
+    time_t y = ((const lcache_file*)b)->mtime;
+    return (x > y) - (x < y);
+}
+
+
+/// Tidies the directory holding `entry`. Removes the
+/// temporary files of recordings that never finished (such
+/// as those of killed runs), then the least recently written
+/// entries until the rest fit in LCACHE_MAX_SIZE.
+static void lcache_sweep(char* entry)
+{
+    char dir[LCACHE_PATH_SIZE];
+    char path[LCACHE_PATH_SIZE + LCACHE_NAME_SIZE];
+    strcpy(dir, entry);
+    *strrchr(dir, '/') = '\0';
+
+    DIR* d = opendir(dir);
+
+    if (d == NULL)
+        return;
+
+    lcache_file* files = NULL;
+    int count = 0;
+    int cap = 0;
+    long long total = 0;
+    time_t now = time(NULL);
+    struct dirent* de;
+
+    while ((de = readdir(d)))
+    {
+        char* ext = strstr(de->d_name, ".lxc");
+        struct stat st;
+
+        if (ext == NULL || strlen(de->d_name) >= LCACHE_NAME_SIZE)
+            continue;
+
+        snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+
+        if (lstat(path, &st) != 0 || !S_ISREG(st.st_mode))
+            continue;
+
+        /// A recording still under way is younger than this.
+        if (ext[4] == '.')
+        {
+            if (now - st.st_mtime > LCACHE_TMP_AGE)
+                unlink(path);
+
+            continue;
+        }
+
+        if (ext[4] != '\0')
+            continue;
+
+        if (count == cap)
+        {
+            cap = cap ? cap * 2 : 64;
+            files = realloc(files, sizeof(lcache_file) * cap);
+        }
+
+        strcpy(files[count].name, de->d_name);
+        files[count].mtime = st.st_mtime;
+        files[count].size = (long)st.st_size;
+        total += st.st_size;
+        count++;
+    }
+
+    closedir(d);
+
+    if (total > LCACHE_MAX_SIZE)
+    {
+        qsort(files, count, sizeof(lcache_file), lcache_file_cmp);
+
+        for (int i = 0; i < count && total > LCACHE_MAX_SIZE; i++)
+        {
+            snprintf(path, sizeof(path), "%s/%s", dir, files[i].name);
+
+            if (unlink(path) == 0)
+                total -= files[i].size;
+        }
+    }
+
+    free(files);
+}
+
+
+#endif  /// _WIN32
+
+
+/////////////////////////////
+/// `lcache` Constructors ///
+/////////////////////////////
+
+#ifndef _WIN32
+
+lcache* lcache_open(char* src)
+{
+    char real[LCACHE_PATH_SIZE];
+    char entry[LCACHE_PATH_SIZE];
+    struct stat st;
+    struct stat est;
+
+    if (!lcache_locate(src, real, entry, &st))
+        return NULL;
+
+    int fd = open(entry, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        return NULL;
+
+    if (fstat(fd, &est) != 0 || est.st_size == 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    char* data = mmap(NULL, est.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+        return NULL;
+
+    lcache* c = lcache_new(entry, NULL);
+    c->data = data;
+    c->len = est.st_size;
+    c->mapped = 1;
+
+    if (!lcache_check(c, real, &st))
+    {
+        lcache_close(c, 0);
+        return NULL;
+    }
+
+    return c;
+}
+
+
+lcache* lcache_record(char* src)
+{
+    char real[LCACHE_PATH_SIZE];
+    char entry[LCACHE_PATH_SIZE];
+    char tmp[LCACHE_PATH_SIZE + 8];
+    struct stat st;
+
+    if (!lcache_locate(src, real, entry, &st))
+        return NULL;
+
+    lcache_mkdir(entry);
+    lcache_sweep(entry);
+    snprintf(tmp, sizeof(tmp), "%s.XXXXXX", entry);
+
+    int fd = mkstemp(tmp);
+
+    if (fd < 0)
+        return NULL;
+
+    FILE* f = fdopen(fd, "wb");
+
+    if (f == NULL)
+    {
+        close(fd);
+        unlink(tmp);
+        return NULL;
+    }
+
+    lcache_header(f, real, &st);
+
+    lcache* c = lcache_new(entry, tmp);
+    c->file = f;
+    return c;
+}
+
+
+#else
+
+
+lcache* lcache_open(char* src) { return NULL; }
+lcache* lcache_record(char* src) { return NULL; }
+
+
+#endif  /// _WIN32
+
+
+lcache* lcache_memory(char* name, const char* data, long len, lenv* e)
+{
+    lcache* c = lcache_new(name, NULL);
+    c->data = (char*)data;
+    c->len = len;
+    c->env = e;
+
+    if (len == 0 || data[len - 1] != LCACHE_END)
+    {
+        lcache_close(c, 0);
+        return NULL;
+    }
+
+    return c;
+}
+
+
+lcache* lcache_stream(char* name, FILE* f, lenv* e)
+{
+    lcache* c = lcache_new(name, NULL);
+    c->file = f;
+    c->env = e;
+    return c;
+}
+
+
+void lcache_close(lcache* c, int commit)
+{
+    #ifndef _WIN32
+    if (c->tmp)
+    {
+        if (commit)
+            putc(LCACHE_END, c->file);
+
+        int failed = ferror(c->file);
+
+        if (fclose(c->file) != 0 || failed || !commit || rename(c->tmp, c->path) != 0)
+            unlink(c->tmp);
+    }
+    else if (c->mapped)
+        munmap(c->data, c->len);
+    #endif  /// _WIN32
+
+    /// Streams stay open for whoever handed them in.
+    if (c->file && !c->tmp && commit)
+        putc(LCACHE_END, c->file);
+
+    free(c->path);
+    free(c->tmp);
+    free(c);
+}
+
+
+////////////////////////
+/// `lcache` Methods ///
+////////////////////////
+
+/// Builtins are stored by the name they are bound to in
+/// `e`. Finds the builtin bound to `name` or, given a
+/// builtin `f`, the name it is bound to.
+static lval* lcache_builtin(lenv* e, char* name, lval* f)
+{
+    for (int i = 0; i < e->count; i++)
+    {
+        lval* v = e->vals[i];
+
+        if (v->type != LVAL_FUN || v->builtin == NULL)
+            continue;
+
+        if (name ? strcmp(e->syms[i], name) == 0 : v->builtin == f->builtin)
+            return name ? v : lval_sym(e->syms[i]);
+    }
+
+    return NULL;
+}
+
+
+static lval* lcache_get(lcache* c)
+{
+    uint64_t n;
+    char* s;
+
+    if (c->pos >= c->len)
+        return NULL;
+
+    int tag = c->data[c->pos++];
+
+    switch (tag)
+    {
+        case LCACHE_NUM:
+            return lcache_get_uint(c, &n) ? lval_num(lcache_num(n)) : NULL;
+
+        case LCACHE_SYM:
+        {
+            long len = lcache_get_str(c, &s);
+            return (len >= 0) ? lval_sym_n(s, (int)len) : NULL;
+        }
+
+        case LCACHE_STR:
+        {
+            long len = lcache_get_str(c, &s);
+            return (len >= 0) ? lval_str_n(s, (int)len) : NULL;
+        }
+
+        case LCACHE_SEXPR:
+        case LCACHE_QEXPR:
+        {
+            if (!lcache_get_uint(c, &n))
+                return NULL;
+
+            lval* x = (tag == LCACHE_SEXPR) ? lval_sexpr() : lval_qexpr();
+
+            for (uint64_t i = 0; i < n; i++)
+            {
+                lval* y = lcache_get(c);
+
+                if (y == NULL)
+                {
+                    lval_del(x);
+                    return NULL;
+                }
+
+                lval_add(x, y);
+            }
+
+            return x;
+        }
+
+        case LCACHE_BUILTIN:
+        {
+            long len = lcache_get_str(c, &s);
+
+            if (len < 0 || c->env == NULL)
+                return NULL;
+
+            lval* k = lval_sym_n(s, (int)len);
+            lval* f = lcache_builtin(c->env, k->sym, NULL);
+            lval_del(k);
+            return f ? lval_copy(f) : NULL;
+        }
+
+        case LCACHE_LAMBDA:
+        {
+            lval* formals = lcache_get(c);
+            lval* body = formals ? lcache_get(c) : NULL;
+
+            if (body == NULL || !lcache_get_uint(c, &n))
+            {
+                if (formals)
+                    lval_del(formals);
+
+                return NULL;
+            }
+
+            lval* f = lval_lambda(formals, body);
+
+            for (uint64_t i = 0; i < n; i++)
+            {
+                lval* k = lcache_get(c);
+                lval* v = k ? lcache_get(c) : NULL;
+
+                if (v == NULL || k->type != LVAL_SYM)
+                {
+                    if (k)
+                        lval_del(k);
+                    if (v)
+                        lval_del(v);
+
+                    lval_del(f);
+                    return NULL;
+                }
+
+                lenv_put(f->env, k, v);
+                lval_del(k);
+                lval_del(v);
+            }
+
+            return f;
+        }
+    }
+
+    return NULL;
+}
+
+
+lval* lcache_read(lcache* c)
+{
+    if (c->pos < c->len && c->data[c->pos] == LCACHE_END)
+        return NULL;
+
+    lval* x = lcache_get(c);
+    return x ? x : lval_err("Cache entry %s is corrupt.", c->path);
+}
+
+
+int lcache_write(lcache* c, lval* v)
+{
+    switch (v->type)
+    {
+        case LVAL_NUM:
+            putc(LCACHE_NUM, c->file);
+            lcache_put_num(c->file, v->num);
+            return 1;
+
+        case LVAL_SYM:
+            putc(LCACHE_SYM, c->file);
+            lcache_put_str(c->file, v->sym);
+            return 1;
+
+        case LVAL_STR:
+            putc(LCACHE_STR, c->file);
+            lcache_put_str(c->file, v->str);
+            return 1;
+
+        case LVAL_SEXPR:
+        case LVAL_QEXPR:
+            putc(v->type == LVAL_SEXPR ? LCACHE_SEXPR : LCACHE_QEXPR, c->file);
+            lcache_put_uint(c->file, (uint64_t)v->count);
+
+            for (int i = 0; i < v->count; i++)
+                if (!lcache_write(c, v->cell[i]))
+                    return 0;
+
+            return 1;
+
+        case LVAL_FUN:
+        {
+            if (v->builtin)
+            {
+                lval* name = c->env ? lcache_builtin(c->env, NULL, v) : NULL;
+
+                if (name == NULL)
+                    return 0;
+
+                putc(LCACHE_BUILTIN, c->file);
+                lcache_put_str(c->file, name->sym);
+                lval_del(name);
+                return 1;
+            }
+
+            /// A function out of a module needs its namespace.
+            if (v->home)
+                return 0;
+
+            putc(LCACHE_LAMBDA, c->file);
+
+            if (!lcache_write(c, v->formals) || !lcache_write(c, v->body))
+                return 0;
+
+            lcache_put_uint(c->file, (uint64_t)v->env->count);
+
+            for (int i = 0; i < v->env->count; i++)
+            {
+                putc(LCACHE_SYM, c->file);
+                lcache_put_str(c->file, v->env->syms[i]);
+
+                if (!lcache_write(c, v->env->vals[i]))
+                    return 0;
+            }
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
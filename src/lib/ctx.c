@@ -0,0 +1,221 @@
+/// pthread_getattr_np is a GNU extension.
+#define _GNU_SOURCE
+
+#include <ctx.h>
+#include <lazy.h>
+#include <lenv.h>
+#include <loop.h>
+#include <lval.h>
+#include <module.h>
+#include <parser.h>
+#include <pool.h>
+#include <utilities.h>
+
+#include <stdlib.h>
+
+
+/// The lowest address calls on this thread may reach, found
+/// the first time it is needed.
+static _Thread_local char* lctx_floor = NULL;
+static _Thread_local int lctx_floor_known = 0;
+
+
+/// Finds the end of the stack of the calling thread,
+/// or NULL if it cannot be found.
+static char* lctx_stack_end(void)
+{
+#if defined(__linux__)
+    pthread_attr_t attr;
+    void* addr = NULL;
+    size_t size = 0;
+
+    if (pthread_getattr_np(pthread_self(), &attr) != 0)
+        return NULL;
+
+    if (pthread_attr_getstack(&attr, &addr, &size) != 0)
+        addr = NULL;
+
+    pthread_attr_destroy(&attr);
+    return addr;
+#elif defined(__APPLE__)
+    pthread_t self = pthread_self();
+    return (char*) pthread_get_stackaddr_np(self) - pthread_get_stacksize_np(self);
+#else
+    return NULL;
+#endif
+}
+
+
+///////////////////////////
+/// `lctx` Constructors ///
+///////////////////////////
+
+lctx* lctx_new(void)
+{
+    lctx* c = malloc(sizeof(lctx));
+    pthread_rwlock_init(&c->lock, NULL);
+    c->threaded = 0;
+
+    c->env = lenv_new();
+    c->env->ctx = c;
+    lenv_add_builtins(c->env);
+
+    c->out = stdout;
+
+    c->max_depth = LCTX_MAX_DEPTH;
+    c->depth = 0;
+    c->loops = 0;
+
+    c->owner = c;
+    c->gen = NULL;
+
+    c->pool = NULL;
+    c->loop = NULL;
+    c->modules = NULL;
+    c->lazy = NULL;
+    c->prof = NULL;
+    c->trace = NULL;
+    c->workers = lix_cpu_count();
+    c->chunk = 0;
+
+    return c;
+}
+
+
+//////////////////////////
+/// `lctx` Destructors ///
+//////////////////////////
+
+void lctx_del(lctx* c)
+{
+    if (c->pool)
+        lpool_del(c->pool);
+
+    if (c->loop)
+        lloop_del(c->loop);
+
+    lmod_del_all(c);
+    lenv_del(c->env);
+
+    if (c->lazy)
+        llazy_del(c->lazy);
+
+    pthread_rwlock_destroy(&c->lock);
+    free(c);
+}
+
+
+//////////////////////
+/// `lctx` Methods ///
+//////////////////////
+
+lval* lctx_eval(lctx* c, char* s)
+{
+    int pos = 0;
+    lval* x = lval_sexpr();
+
+    for (lval_read_skip(s, &pos); s[pos] != '\0'; lval_read_skip(s, &pos))
+    {
+        lval* expr = lval_read(s, &pos);
+        lval_del(x);
+
+        if (expr->type == LVAL_ERR)
+            return expr;
+
+        x = lval_eval(c->env, expr);
+
+        if (x->type == LVAL_ERR)
+            break;
+    }
+
+    return x;
+}
+
+
+void lctx_fork(lctx* c, lctx* task)
+{
+    task->env = c->env;
+    task->out = c->out;
+
+    task->max_depth = c->max_depth;
+    task->depth = 0;
+    task->loops = 0;
+
+    task->owner = c->owner;
+    task->gen = NULL;
+
+    task->pool = NULL;
+    task->loop = NULL;
+    task->modules = NULL;
+    task->lazy = NULL;
+    task->prof = NULL;
+    task->trace = NULL;
+    task->threaded = c->threaded;
+    task->workers = c->workers;
+    task->chunk = c->chunk;
+}
+
+
+lpool* lctx_pool(lctx* c)
+{
+    c = c->owner;
+
+    /// Set before the first worker starts, while the owner
+    /// is still the only thread reading `env`.
+    if (c->pool == NULL)
+    {
+        c->threaded = 1;
+        c->pool = lpool_new(c->workers);
+    }
+
+    return c->pool;
+}
+
+
+lloop* lctx_loop(lctx* c)
+{
+    c = c->owner;
+
+    if (c->loop == NULL)
+        c->loop = lloop_new();
+
+    return c->loop;
+}
+
+
+/// Finds the first floor of the calling thread.
+static void lctx_stack_init(void)
+{
+    if (lctx_floor_known)
+        return;
+
+    char* end = lctx_stack_end();
+    lctx_floor = end ? end + LCTX_STACK_MARGIN : NULL;
+    lctx_floor_known = 1;
+}
+
+
+char* lctx_stack_floor(char* floor)
+{
+    lctx_stack_init();
+
+    char* prev = lctx_floor;
+    lctx_floor = floor;
+    return prev;
+}
+
+
+int lctx_stack_low(void)
+{
+    char here;
+
+    lctx_stack_init();
+
+    return lctx_floor && &here < lctx_floor;
+}
+
+
+FILE* lctx_out(lenv* e)
+{
+    return e->ctx ? e->ctx->out : stdout;
+}
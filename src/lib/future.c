@@ -0,0 +1,92 @@
+#include <future.h>
+#include <ctx.h>
+#include <lenv.h>
+#include <lval.h>
+
+#include <stdlib.h>
+
+
+static void lfut_run(void* arg)
+{
+    lfut* f = arg;
+
+    f->result = lval_eval(f->env, f->expr);
+    f->expr = NULL;
+
+    lenv_del(f->env);
+    f->env = NULL;
+}
+
+
+static void lfut_release(void* arg)
+{
+    lfut_unref(arg);
+}
+
+
+///////////////////////////
+/// `lfut` Constructors ///
+///////////////////////////
+
+lfut* lfut_spawn(lenv* e, lval* expr)
+{
+    lfut* f = malloc(sizeof(lfut));
+    f->refs = 1;
+    f->expr = expr;
+    f->env = NULL;
+    f->group.pending = 0;
+    f->result = NULL;
+
+    if (e->ctx == NULL)
+    {
+        f->result = lval_eval(e, expr);
+        f->expr = NULL;
+        return f;
+    }
+
+    lctx_fork(e->ctx, &f->ctx);
+
+    f->env = lenv_snapshot(e);
+    f->env->ctx = &f->ctx;
+
+    lpool_submit(lctx_pool(&f->ctx), &f->group, lfut_run, lfut_release, lfut_ref(f));
+    return f;
+}
+
+
+lfut* lfut_ref(lfut* f)
+{
+    f->refs++;
+    return f;
+}
+
+
+void lfut_unref(lfut* f)
+{
+    if (--f->refs > 0)
+        return;
+
+    if (f->result)
+        lval_del(f->result);
+
+    free(f);
+}
+
+
+//////////////////////
+/// `lfut` Methods ///
+//////////////////////
+
+lval* lfut_result(lfut* f)
+{
+    if (f->group.pending > 0)
+        lpool_wait(lctx_pool(&f->ctx), &f->group);
+
+    return f->result;
+}
+
+
+lval* lfut_await(lfut* f)
+{
+    return lval_copy(lfut_result(f));
+}
@@ -0,0 +1,285 @@
+/// ucontext is an XSI interface.
+#define _XOPEN_SOURCE 700
+
+#include <generator.h>
+#include <ctx.h>
+#include <lenv.h>
+#include <lval.h>
+
+#include <stdlib.h>
+
+#ifndef _WIN32
+
+#include <stdatomic.h>
+#include <ucontext.h>
+
+
+/// \brief Enum for the states of a generator
+///
+/// The possible states are:
+/// - LGEN_READY : Not started yet
+/// - LGEN_PAUSED : Paused at a `yield`
+/// - LGEN_RUNNING : Being resumed
+/// - LGEN_DONE : Finished
+enum { LGEN_READY, LGEN_PAUSED, LGEN_RUNNING, LGEN_DONE };
+
+
+/// \brief Represents a generator
+///
+/// A generator evaluates its expression on its own stack,
+/// switching back to whoever resumed it at each `yield`.
+/// The evaluator itself is unaware of the switch: a paused
+/// evaluation is simply a stack that is not running.
+///
+/// A `lgen` consists of a:
+/// - refs      : atomic int corresponding to the number of owners
+/// - state     : atomic int corresponding to an LGEN enum value
+/// - closing   : int set once every `yield` should fail
+/// - expr      : lval* corresponding to the S-Expression to evaluate
+/// - env       : lenv* corresponding to the snapshot `expr` is evaluated in
+/// - ctx       : lctx corresponding to the context of the generator
+/// - out       : lval* corresponding to the value being handed out (if any)
+/// - stack     : char* corresponding to the stack of the generator
+/// - self      : ucontext_t corresponding to the generator's own execution
+/// - caller    : ucontext_t corresponding to the execution that resumed it
+struct lgen
+{
+    _Atomic int refs;
+    _Atomic int state;
+    int closing;
+
+    lval* expr;
+    lenv* env;
+    lctx ctx;
+
+    lval* out;
+
+    char* stack;
+    ucontext_t self;
+    ucontext_t caller;
+};
+
+
+/// The generator being started on this thread, which
+/// makecontext cannot pass as a pointer.
+static _Thread_local lgen* lgen_starting = NULL;
+
+/// The generator most recently resumed on this thread
+/// and still running.
+static _Thread_local lgen* lgen_current = NULL;
+
+
+static void lgen_entry(void)
+{
+    lgen* g = lgen_starting;
+    lval* r = lval_eval(g->env, g->expr);
+    g->expr = NULL;
+
+    if (r->type == LVAL_ERR && !g->closing)
+        g->out = r;
+    else
+        lval_del(r);
+
+    g->state = LGEN_DONE;
+}
+
+
+///////////////////////////
+/// `lgen` Constructors ///
+///////////////////////////
+
+/// Sets up `g` to start in lgen_entry on its own stack.
+/// Kept apart from lgen_new so no local of the caller is
+/// live across getcontext.
+static int lgen_init_context(lgen* g)
+{
+    if (getcontext(&g->self) != 0)
+        return 0;
+
+    g->self.uc_stack.ss_sp = g->stack;
+    g->self.uc_stack.ss_size = LGEN_STACK_SIZE;
+    g->self.uc_link = &g->caller;
+    makecontext(&g->self, lgen_entry, 0);
+    return 1;
+}
+
+
+lgen* lgen_new(lenv* e, lval* expr)
+{
+    lgen* g = malloc(sizeof(lgen));
+    g->stack = malloc(LGEN_STACK_SIZE);
+
+    if (g->stack == NULL || !lgen_init_context(g))
+    {
+        free(g->stack);
+        free(g);
+        lval_del(expr);
+        return NULL;
+    }
+
+    g->refs = 1;
+    g->state = LGEN_READY;
+    g->closing = 0;
+
+    g->expr = expr;
+    g->out = NULL;
+
+    lctx_fork(e->ctx, &g->ctx);
+    g->ctx.gen = g;
+
+    g->env = lenv_snapshot(e);
+    g->env->ctx = &g->ctx;
+
+    return g;
+}
+
+
+lgen* lgen_ref(lgen* g)
+{
+    g->refs++;
+    return g;
+}
+
+
+void lgen_unref(lgen* g)
+{
+    if (--g->refs > 0)
+        return;
+
+    if (g->state == LGEN_PAUSED)
+    {
+        g->closing = 1;
+
+        lval* x = lgen_next(g);
+
+        if (x)
+            lval_del(x);
+    }
+
+    if (g->expr)
+        lval_del(g->expr);
+
+    if (g->out)
+        lval_del(g->out);
+
+    lenv_del(g->env);
+    free(g->stack);
+    free(g);
+}
+
+
+//////////////////////
+/// `lgen` Methods ///
+//////////////////////
+
+lval* lgen_next(lgen* g)
+{
+    int state = atomic_load(&g->state);
+
+    if (state == LGEN_DONE)
+    {
+        lval* x = g->out;
+        g->out = NULL;
+        return x;
+    }
+
+    if (!atomic_compare_exchange_strong(&g->state, &state, LGEN_RUNNING))
+        return lval_err("Generator is already running.");
+
+    if (state == LGEN_READY)
+        lgen_starting = g;
+
+    /// Calls made by the generator are bounded by its own stack.
+    char* floor = lctx_stack_floor(g->stack + LCTX_STACK_MARGIN);
+    lgen* current = lgen_current;
+    lgen_current = g;
+
+    swapcontext(&g->caller, &g->self);
+
+    lgen_current = current;
+    lctx_stack_floor(floor);
+
+    lval* x = g->out;
+    g->out = NULL;
+
+    if (g->state == LGEN_RUNNING)
+        g->state = LGEN_PAUSED;
+
+    return x;
+}
+
+
+void lgen_each(lgen* g, void (*f)(lval*, void*), void* data)
+{
+    int state = atomic_load(&g->state);
+
+    /// Another thread may be changing a generator it runs.
+    if (state == LGEN_RUNNING && g != lgen_current)
+        return;
+
+    if (state == LGEN_READY && g->expr)
+        f(g->expr, data);
+
+    for (int i = 0; i < g->env->count; i++)
+        f(g->env->vals[i], data);
+}
+
+
+lval* lgen_yield(lenv* e, lval* v)
+{
+    lgen* g = e->ctx ? e->ctx->gen : NULL;
+
+    if (g == NULL)
+    {
+        lval_del(v);
+        return lval_err("Function 'yield' called outside of a generator.");
+    }
+
+    if (g->closing)
+    {
+        lval_del(v);
+        return lval_err("Generator closed.");
+    }
+
+    g->out = v;
+    swapcontext(&g->self, &g->caller);
+    return lval_sexpr();
+}
+
+
+#else
+
+
+lgen* lgen_new(lenv* e, lval* expr)
+{
+    lval_del(expr);
+    return NULL;
+}
+
+
+lgen* lgen_ref(lgen* g)
+{
+    return g;
+}
+
+
+void lgen_unref(lgen* g) {}
+
+
+lval* lgen_next(lgen* g)
+{
+    return lval_err("Generators are not supported on this platform.");
+}
+
+
+void lgen_each(lgen* g, void (*f)(lval*, void*), void* data) {}
+
+
+lval* lgen_yield(lenv* e, lval* v)
+{
+    lval_del(v);
+    return lval_err("Generators are not supported on this platform.");
+}
+
+
+#endif  /// _WIN32
@@ -0,0 +1,392 @@
+#include <hamt.h>
+#include <lval.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LHAMT_BITS 5
+#define LHAMT_MASK 31
+#define LHAMT_MAX_SHIFT (int)(sizeof(unsigned long) * 8)
+
+
+////////////////////////////
+/// `lhent` Constructors ///
+////////////////////////////
+
+static lhent* lhent_new(lval* k, lval* v, unsigned long h)
+{
+    lhent* x = malloc(sizeof(lhent));
+    x->refs = 1;
+    x->hash = h;
+    x->key = k;
+    x->val = v;
+    return x;
+}
+
+
+static lhent* lhent_ref(lhent* x)
+{
+    x->refs++;
+    return x;
+}
+
+
+static void lhent_unref(lhent* x)
+{
+    if (--x->refs > 0)
+        return;
+
+    lval_del(x->key);
+
+    if (x->val)
+        lval_del(x->val);
+
+    free(x);
+}
+
+
+////////////////////////////
+/// `lhamt` Constructors ///
+////////////////////////////
+
+static lhamt* lhamt_new(int count)
+{
+    lhamt* n = malloc(sizeof(lhamt));
+    n->refs = 1;
+    n->collision = 0;
+    n->bitmap = 0;
+    n->count = count;
+    n->ents = calloc(count, sizeof(lhent*));
+    n->nodes = calloc(count, sizeof(lhamt*));
+    return n;
+}
+
+
+/// Copies `n` with `count` slots, leaving a gap at `gap`
+/// (if `grow`) or skipping slot `gap` (if not). Every
+/// shared child and entry gains a reference.
+static lhamt* lhamt_copy(lhamt* n, int gap, int grow)
+{
+    int count = n->count + (grow ? 1 : (gap >= 0 ? -1 : 0));
+    lhamt* x = lhamt_new(count);
+    x->collision = n->collision;
+    x->bitmap = n->bitmap;
+
+    for (int i = 0, j = 0; i < n->count; i++, j++)
+    {
+        if (i == gap)
+        {
+            if (grow)
+                j++;
+            else
+            {
+                j--;
+                continue;
+            }
+        }
+
+        if (n->ents[i])
+            x->ents[j] = lhent_ref(n->ents[i]);
+        else
+            x->nodes[j] = lhamt_ref(n->nodes[i]);
+    }
+
+    return x;
+}
+
+
+lhamt* lhamt_ref(lhamt* n)
+{
+    n->refs++;
+    return n;
+}
+
+
+void lhamt_unref(lhamt* n)
+{
+    if (n == NULL || --n->refs > 0)
+        return;
+
+    for (int i = 0; i < n->count; i++)
+        if (n->ents[i])
+            lhent_unref(n->ents[i]);
+        else if (n->nodes[i])
+            lhamt_unref(n->nodes[i]);
+
+    free(n->ents);
+    free(n->nodes);
+    free(n);
+}
+
+
+///////////////////////
+/// `lhamt` Methods ///
+///////////////////////
+
+static int lhamt_popcount(unsigned int x)
+{
+    int c = 0;
+
+    for (; x; c++)
+        x &= x - 1;
+
+    return c;
+}
+
+
+static int lhamt_matches(lhent* x, lval* k, unsigned long h)
+{
+    return x->hash == h && lval_eq(x->key, k);
+}
+
+
+lhent* lhamt_find(lhamt* n, lval* k, unsigned long h)
+{
+    for (int shift = 0; n; shift += LHAMT_BITS)
+    {
+        if (n->collision)
+        {
+            for (int i = 0; i < n->count; i++)
+                if (lhamt_matches(n->ents[i], k, h))
+                    return n->ents[i];
+
+            return NULL;
+        }
+
+        unsigned int bit = 1u << ((h >> shift) & LHAMT_MASK);
+
+        if (!(n->bitmap & bit))
+            return NULL;
+
+        int pos = lhamt_popcount(n->bitmap & (bit - 1));
+
+        if (n->ents[pos])
+            return lhamt_matches(n->ents[pos], k, h) ? n->ents[pos] : NULL;
+
+        n = n->nodes[pos];
+    }
+
+    return NULL;
+}
+
+
+/// Inserts the entry `x` below `n` at depth `shift`.
+/// Returns a new node; `n` keeps its reference and `x`
+/// is consumed.
+static lhamt* lhamt_put(lhamt* n, lhent* x, int shift, int* added)
+{
+    if (shift >= LHAMT_MAX_SHIFT)
+    {
+        if (n == NULL)
+        {
+            lhamt* c = lhamt_new(1);
+            c->collision = 1;
+            c->ents[0] = x;
+            *added = 1;
+            return c;
+        }
+
+        for (int i = 0; i < n->count; i++)
+            if (lhamt_matches(n->ents[i], x->key, x->hash))
+            {
+                lhamt* c = lhamt_copy(n, -1, 0);
+                lhent_unref(c->ents[i]);
+                c->ents[i] = x;
+                return c;
+            }
+
+        lhamt* c = lhamt_copy(n, n->count, 1);
+        c->ents[n->count] = x;
+        *added = 1;
+        return c;
+    }
+
+    unsigned int bit = 1u << ((x->hash >> shift) & LHAMT_MASK);
+
+    if (n == NULL)
+    {
+        lhamt* c = lhamt_new(1);
+        c->bitmap = bit;
+        c->ents[0] = x;
+        *added = 1;
+        return c;
+    }
+
+    int pos = lhamt_popcount(n->bitmap & (bit - 1));
+
+    if (!(n->bitmap & bit))
+    {
+        lhamt* c = lhamt_copy(n, pos, 1);
+        c->bitmap |= bit;
+        c->ents[pos] = x;
+        *added = 1;
+        return c;
+    }
+
+    lhamt* child;
+
+    if (n->ents[pos] && lhamt_matches(n->ents[pos], x->key, x->hash))
+    {
+        lhamt* c = lhamt_copy(n, -1, 0);
+        lhent_unref(c->ents[pos]);
+        c->ents[pos] = x;
+        return c;
+    }
+    else if (n->ents[pos])
+    {
+        int unused = 0;
+        lhamt* t = lhamt_put(NULL, lhent_ref(n->ents[pos]), shift + LHAMT_BITS, &unused);
+        child = lhamt_put(t, x, shift + LHAMT_BITS, added);
+        lhamt_unref(t);
+    }
+    else
+        child = lhamt_put(n->nodes[pos], x, shift + LHAMT_BITS, added);
+
+    lhamt* c = lhamt_copy(n, -1, 0);
+
+    if (c->ents[pos])
+        lhent_unref(c->ents[pos]);
+    else
+        lhamt_unref(c->nodes[pos]);
+
+    c->ents[pos] = NULL;
+    c->nodes[pos] = child;
+    return c;
+}
+
+
+lhamt* lhamt_insert(lhamt* n, lval* k, lval* v, unsigned long h, int* added)
+{
+    *added = 0;
+    return lhamt_put(n, lhent_new(k, v, h), 0, added);
+}
+
+
+/// Removes `k` from below `n` at depth `shift`. Returns
+/// a new reference to `n` itself when `k` is absent and
+/// NULL once a node has no slots left.
+static lhamt* lhamt_drop(lhamt* n, lval* k, unsigned long h, int shift, int* removed)
+{
+    if (n->collision)
+    {
+        for (int i = 0; i < n->count; i++)
+            if (lhamt_matches(n->ents[i], k, h))
+            {
+                *removed = 1;
+                return (n->count == 1) ? NULL : lhamt_copy(n, i, 0);
+            }
+
+        return lhamt_ref(n);
+    }
+
+    unsigned int bit = 1u << ((h >> shift) & LHAMT_MASK);
+
+    if (!(n->bitmap & bit))
+        return lhamt_ref(n);
+
+    int pos = lhamt_popcount(n->bitmap & (bit - 1));
+
+    if (n->ents[pos])
+    {
+        if (!lhamt_matches(n->ents[pos], k, h))
+            return lhamt_ref(n);
+
+        *removed = 1;
+
+        if (n->count == 1)
+            return NULL;
+
+        lhamt* c = lhamt_copy(n, pos, 0);
+        c->bitmap &= ~bit;
+        return c;
+    }
+
+    lhamt* child = lhamt_drop(n->nodes[pos], k, h, shift + LHAMT_BITS, removed);
+
+    if (child == n->nodes[pos])
+    {
+        lhamt_unref(child);
+        return lhamt_ref(n);
+    }
+
+    if (child == NULL)
+    {
+        if (n->count == 1)
+            return NULL;
+
+        lhamt* c = lhamt_copy(n, pos, 0);
+        c->bitmap &= ~bit;
+        return c;
+    }
+
+    lhamt* c = lhamt_copy(n, -1, 0);
+    lhamt_unref(c->nodes[pos]);
+
+    if (child->count == 1 && child->ents[0])
+    {
+        c->nodes[pos] = NULL;
+        c->ents[pos] = lhent_ref(child->ents[0]);
+        lhamt_unref(child);
+    }
+    else
+        c->nodes[pos] = child;
+
+    return c;
+}
+
+
+lhamt* lhamt_remove(lhamt* n, lval* k, unsigned long h, int* removed)
+{
+    *removed = 0;
+    return n ? lhamt_drop(n, k, h, 0, removed) : NULL;
+}
+
+
+void lhamt_each(lhamt* n, void (*fn)(lhent*, void*), void* data)
+{
+    if (n == NULL)
+        return;
+
+    for (int i = 0; i < n->count; i++)
+        if (n->ents[i])
+            fn(n->ents[i], data);
+        else
+            lhamt_each(n->nodes[i], fn, data);
+}
+
+
+struct lhamt_collect_data
+{
+    lval* q;
+    int part;
+};
+
+
+static void lhamt_collect_entry(lhent* x, void* data)
+{
+    struct lhamt_collect_data* d = data;
+
+    switch (d->part)
+    {
+        case LHAMT_KEYS:
+            lval_add(d->q, lval_copy(x->key));
+            break;
+
+        case LHAMT_VALS:
+            lval_add(d->q, lval_copy(x->val));
+            break;
+
+        case LHAMT_PAIRS:
+            lval_add(d->q, lval_add(lval_add(lval_qexpr(), 
+                    lval_copy(x->key)), lval_copy(x->val)));
+            break;
+    }
+}
+
+
+lval* lhamt_collect(lhamt* n, int part)
+{
+    struct lhamt_collect_data d = { lval_qexpr(), part };
+    lhamt_each(n, lhamt_collect_entry, &d);
+    return d.q;
+}
@@ -0,0 +1,164 @@
+#include <heap.h>
+#include <lval.h>
+#include <utilities.h>
+
+#include <stdatomic.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <sys/resource.h>
+#endif  /// _WIN32
+
+
+/////////////////////
+/// Heap Counters ///
+/////////////////////
+
+#ifdef LIX_HEAP_STATS
+
+
+/// Shared by every instance and thread in the process.
+static _Atomic long lheap_live[LHEAP_TYPES];
+static _Atomic long lheap_total = 0;
+static _Atomic long lheap_peak = 0;
+static _Atomic long lheap_allocated = 0;
+static _Atomic long lheap_freed = 0;
+static _Atomic long lheap_copies = 0;
+static _Atomic long lheap_copied_bytes = 0;
+static _Atomic long lheap_envs = 0;
+static _Atomic long lheap_bindings = 0;
+
+
+void lheap_alloc(int t)
+{
+    atomic_fetch_add(&lheap_live[t], 1);
+    atomic_fetch_add(&lheap_allocated, 1);
+
+    long n = atomic_fetch_add(&lheap_total, 1) + 1;
+    long peak = atomic_load(&lheap_peak);
+
+    while (n > peak && !atomic_compare_exchange_weak(&lheap_peak, &peak, n))
+        ;
+}
+
+
+void lheap_free(int t)
+{
+    atomic_fetch_sub(&lheap_live[t], 1);
+    atomic_fetch_sub(&lheap_total, 1);
+    atomic_fetch_add(&lheap_freed, 1);
+}
+
+
+void lheap_copied(lval* v)
+{
+    long n = sizeof(lval);
+
+    switch (v->type)
+    {
+        case LVAL_ERR:
+            n += strlen(v->err) + 1;
+            break;
+
+        case LVAL_SYM:
+            n += strlen(v->sym) + 1;
+            break;
+
+        case LVAL_STR:
+            n += strlen(v->str) + 1;
+            break;
+
+        case LVAL_FUN:
+            if (!v->builtin && v->sym)
+                n += strlen(v->sym) + 1;
+            break;
+
+        case LVAL_SEXPR:
+        case LVAL_QEXPR:
+        case LVAL_RECUR:
+            n += sizeof(lval*) * v->count;
+            break;
+    }
+
+    atomic_fetch_add(&lheap_copies, 1);
+    atomic_fetch_add(&lheap_copied_bytes, n);
+}
+
+
+void lheap_env_copied(lenv* e)
+{
+    atomic_fetch_add(&lheap_envs, 1);
+    atomic_fetch_add(&lheap_bindings, e->count);
+}
+
+
+int lheap_snapshot(lheap_stats* s)
+{
+    for (int i = 0; i < LHEAP_TYPES; i++)
+        s->live[i] = atomic_load(&lheap_live[i]);
+
+    s->total = atomic_load(&lheap_total);
+    s->peak = atomic_load(&lheap_peak);
+    s->allocated = atomic_load(&lheap_allocated);
+    s->freed = atomic_load(&lheap_freed);
+    s->copies = atomic_load(&lheap_copies);
+    s->copied = atomic_load(&lheap_copied_bytes);
+    s->envs = atomic_load(&lheap_envs);
+    s->bindings = atomic_load(&lheap_bindings);
+    s->rss = 0;
+
+    #ifndef _WIN32
+        struct rusage ru;
+
+        /// Kilobytes on Linux, bytes on macOS.
+        if (getrusage(RUSAGE_SELF, &ru) == 0)
+            s->rss = ru.ru_maxrss;
+
+        #ifdef __APPLE__
+            s->rss /= 1024;
+        #endif  /// __APPLE__
+    #endif  /// _WIN32
+
+    return 1;
+}
+
+
+#else
+
+
+void lheap_alloc(int t) {}
+void lheap_free(int t) {}
+void lheap_copied(lval* v) {}
+void lheap_env_copied(lenv* e) {}
+
+
+int lheap_snapshot(lheap_stats* s)
+{
+    return 0;
+}
+
+
+#endif  /// LIX_HEAP_STATS
+
+
+void lheap_report(FILE* out)
+{
+    lheap_stats s;
+
+    if (!lheap_snapshot(&s))
+    {
+        fprintf(out, "Heap statistics are not kept by this build "
+                     "(define LIX_HEAP_STATS).\n");
+        return;
+    }
+
+    fprintf(out, "lvals: %ld live, %ld peak (%ld bytes), %ld allocated, %ld freed\n",
+            s.total, s.peak, s.peak * (long)sizeof(lval), s.allocated, s.freed);
+    fprintf(out, "lval_copy: %ld lvals, %ld bytes\n", s.copies, s.copied);
+    fprintf(out, "lenv_copy: %ld calls, %ld bindings\n", s.envs, s.bindings);
+    fprintf(out, "peak resident size: %ld KB\n", s.rss);
+
+    for (int i = 0; i < LHEAP_TYPES; i++)
+        if (s.live[i] != 0)
+            fprintf(out, "  %-14s %ld live\n", ltype_name(i), s.live[i]);
+}
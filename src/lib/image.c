@@ -0,0 +1,215 @@
+#include <image.h>
+#include <builtins.h>
+#include <cache.h>
+#include <lenv.h>
+#include <lval.h>
+#include <utilities.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIMAGE_MAGIC "LIXI"
+#define LIMAGE_NAME "prelude image"
+#define LIMAGE_ROW 12
+
+
+/// Checks the header form `h` of the image against
+/// the interpreter and the prelude at `src`.
+static int limage_check(lval* h, char* src)
+{
+    if (h == NULL || h->type != LVAL_QEXPR || h->count != 4)
+        return 0;
+
+    if (h->cell[0]->type != LVAL_STR || strcmp(h->cell[0]->str, LIMAGE_MAGIC) != 0
+        || h->cell[1]->type != LVAL_NUM || h->cell[1]->num != LIMAGE_FORMAT
+        || h->cell[2]->type != LVAL_STR || strcmp(h->cell[2]->str, LIX_VERSION) != 0
+        || h->cell[3]->type != LVAL_STR)
+        return 0;
+
+    long len;
+    char* text = src ? lix_read_file(src, &len) : NULL;
+
+    /// With no prelude on disk the image is all there is.
+    if (text == NULL)
+        return 1;
+
+    int same = len == (long)strlen(h->cell[3]->str) && memcmp(text, h->cell[3]->str, len) == 0;
+    free(text);
+    return same;
+}
+
+
+lval* limage_restore(lenv* e, char* src)
+{
+    lcache* c = lcache_memory(LIMAGE_NAME, (const char*)limage_prelude, limage_prelude_len, e);
+
+    if (c == NULL)
+        return NULL;
+
+    lval* h = lcache_read(c);
+
+    if (!limage_check(h, src))
+    {
+        if (h)
+            lval_del(h);
+
+        lcache_close(c, 0);
+        return NULL;
+    }
+
+    lval_del(h);
+
+    /// Every binding is decoded before any is bound, so an
+    /// image that fails partway (as when a builtin has been
+    /// renamed since it was built) leaves `e` untouched.
+    lval* binds = lval_qexpr();
+    lval* x;
+
+    while ((x = lcache_read(c)))
+    {
+        if (x->type != LVAL_QEXPR || x->count != 2 || x->cell[0]->type != LVAL_SYM)
+        {
+            lval_del(x);
+            lval_del(binds);
+            lcache_close(c, 0);
+            return NULL;
+        }
+
+        lval_add(binds, x);
+    }
+
+    lcache_close(c, 0);
+
+    for (int i = 0; i < binds->count; i++)
+    {
+        lval* b = binds->cell[i];
+        lval_name(b->cell[1], b->cell[0]->sym);
+        lenv_put(e, b->cell[0], b->cell[1]);
+    }
+
+    lval_del(binds);
+    return lval_sexpr();
+}
+
+
+/// Checks whether the binding `i` of `e` is one of
+/// the builtins every environment starts with.
+static int limage_builtin(lenv* e, int i, lenv* b)
+{
+    if (e->vals[i]->type != LVAL_FUN || e->vals[i]->builtin == NULL)
+        return 0;
+
+    for (int j = 0; j < b->count; j++)
+        if (strcmp(b->syms[j], e->syms[i]) == 0)
+            return b->vals[j]->builtin == e->vals[i]->builtin;
+
+    return 0;
+}
+
+
+/// Encodes the globals of `e` after the header into `f`.
+static lval* limage_encode(lenv* e, char* text, FILE* f)
+{
+    lcache* c = lcache_stream(LIMAGE_NAME, f, e);
+    lenv* b = lenv_new();
+    lenv_add_builtins(b);
+
+    lval* h = lval_qexpr();
+    lval_add(h, lval_str(LIMAGE_MAGIC));
+    lval_add(h, lval_num(LIMAGE_FORMAT));
+    lval_add(h, lval_str(LIX_VERSION));
+    lval_add(h, lval_str(text));
+
+    lval* err = NULL;
+
+    if (!lcache_write(c, h))
+        err = lval_err("Could not write the header of the %s.", LIMAGE_NAME);
+
+    lval_del(h);
+
+    for (int i = 0; err == NULL && i < e->count; i++)
+    {
+        if (limage_builtin(e, i, b))
+            continue;
+
+        lval* x = lval_qexpr();
+        lval_add(x, lval_sym(e->syms[i]));
+        lval_add(x, lval_copy(e->vals[i]));
+
+        if (!lcache_write(c, x))
+            err = lval_err("Cannot image the %s bound to '%s'.",
+                           ltype_name(e->vals[i]->type), e->syms[i]);
+
+        lval_del(x);
+    }
+
+    lenv_del(b);
+    lcache_close(c, err == NULL);
+    return err;
+}
+
+
+lval* limage_build(lenv* e, char* src, char* out)
+{
+    long len;
+    char* text = lix_read_file(src, &len);
+
+    if (text == NULL)
+        return lval_err("Could not read prelude %s", src);
+
+    lval* x = builtin_load(e, lval_add(lval_sexpr(), lval_str(src)));
+
+    if (x->type == LVAL_ERR)
+    {
+        free(text);
+        return x;
+    }
+
+    lval_del(x);
+
+    /// The encoding is staged in a temporary file so
+    /// nothing is written to `out` unless it succeeds.
+    FILE* tmp = tmpfile();
+
+    if (tmp == NULL)
+    {
+        free(text);
+        return lval_err("Could not create a temporary file for the %s.", LIMAGE_NAME);
+    }
+
+    lval* err = limage_encode(e, text, tmp);
+    free(text);
+
+    FILE* f = err ? NULL : fopen(out, "w");
+
+    if (err == NULL && f == NULL)
+        err = lval_err("Could not open %s", out);
+
+    if (err)
+    {
+        fclose(tmp);
+        return err;
+    }
+
+    fprintf(f, "/// Generated from %s by create-image.sh. Do not edit.\n\n", src);
+    fputs("#include <image.h>\n\n\n", f);
+    fputs("const unsigned char limage_prelude[] = {", f);
+
+    rewind(tmp);
+
+    long n = 0;
+
+    for (int b; (b = getc(tmp)) != EOF; n++)
+        fprintf(f, "%s0x%02x,", (n % LIMAGE_ROW) ? " " : "\n    ", b);
+
+    fputs("\n};\n\n\n", f);
+    fputs("const long limage_prelude_len = sizeof(limage_prelude);\n", f);
+
+    fclose(tmp);
+
+    if (fclose(f) != 0)
+        return lval_err("Could not write %s", out);
+
+    return lval_sexpr();
+}
@@ -1,61 +1,528 @@
 #include <io.h>
+#include <cache.h>
+#include <ctx.h>
+#include <hamt.h>
+#include <module.h>
 #include <parser.h>
+#include <pool.h>
+#include <writer.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#define LSRC_BUFFER_SIZE 4096
+#define LSRC_CHUNK_SIZE (256 * 1024)
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif  /// _WIN32
+
+
+//////////////////////
+/// `lval` Reading ///
+//////////////////////
+
+static lsrc* lsrc_new(char* data, long len, FILE* stream)
+{
+    lsrc* s = malloc(sizeof(lsrc));
+    s->data = data;
+    s->len = len;
+    s->pos = 0;
+    s->mapped = stream == NULL;
+    s->stream = stream;
+    s->pool = NULL;
+    s->workers = 1;
+    s->ahead = NULL;
+    s->taken = 0;
+    s->cache = NULL;
+    s->record = NULL;
+    return s;
+}
+
+
+/// Opens the source text of the file at `path`.
+static lsrc* lsrc_source(char* path)
+{
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    long page = sysconf(_SC_PAGESIZE);
+
+    /// The mapping is only null terminated by the zero
+    /// fill of its last page, so a file ending exactly
+    /// on a page boundary is streamed instead.
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+        && st.st_size > 0 && st.st_size % page != 0)
+    {
+        char* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data != MAP_FAILED)
+        {
+            close(fd);
+            return lsrc_new(data, st.st_size, NULL);
+        }
+    }
+
+    FILE* f = fdopen(fd, "rb");
+#else
+    FILE* f = fopen(path, "rb");
+#endif  /// _WIN32
+
+    if (f == NULL)
+        return NULL;
+
+    return lsrc_new(calloc(LSRC_BUFFER_SIZE, 1), LSRC_BUFFER_SIZE, f);
+}
+
+
+lsrc* lsrc_open(char* path)
+{
+    lcache* c = lcache_open(path);
+
+    if (c)
+    {
+        lsrc* s = lsrc_new(NULL, 0, NULL);
+        s->mapped = 0;
+        s->cache = c;
+        return s;
+    }
+
+    lsrc* s = lsrc_source(path);
+
+    if (s)
+        s->record = lcache_record(path);
+
+    return s;
+}
+
+
+/// Appends `c` to the form buffered in `s`.
+static void lsrc_put(lsrc* s, int c)
+{
+    if (s->pos + 1 >= s->len)
+    {
+        s->len *= 2;
+        s->data = realloc(s->data, s->len);
+    }
+
+    s->data[s->pos++] = (char)c;
+}
+
+
+static int lsrc_space(int c)
+{
+    return c == ' ' || c == '\t' || c == '\v' || c == '\r' || c == '\n';
+}
+
+
+static int lsrc_delim(int c)
+{
+    return lsrc_space(c) || c == '(' || c == ')' || c == '{' 
+        || c == '}' || c == '"' || c == ';' || c == EOF;
+}
+
+
+/// Buffers the next top-level form of the stream. Only
+/// brackets, strings and comments are tracked; the form
+/// is left for the parser to check. Returns 0 at the end
+/// of the stream.
+static int lsrc_fill(lsrc* s)
+{
+    FILE* f = s->stream;
+    int c;
+
+    s->pos = 0;
+
+    for (;;)
+    {
+        while (lsrc_space(c = getc(f)));
+
+        if (c != ';')
+            break;
+
+        while ((c = getc(f)) != '\n' && c != EOF);
+    }
+
+    if (c == EOF)
+        return 0;
+
+    int depth = 0;
+
+    do
+    {
+        if (lsrc_space(c))
+            lsrc_put(s, c);
+        else if (c == ';')
+        {
+            while ((c = getc(f)) != '\n' && c != EOF);
+
+            lsrc_put(s, '\n');
+        }
+        else if (c == '"')
+        {
+            lsrc_put(s, c);
+
+            while ((c = getc(f)) != '"' && c != EOF)
+            {
+                lsrc_put(s, c);
+
+                if (c == '\\' && (c = getc(f)) != EOF)
+                    lsrc_put(s, c);
+            }
+
+            if (c == EOF)
+                break;
+
+            lsrc_put(s, c);
+        }
+        else if (c == '(' || c == '{')
+        {
+            lsrc_put(s, c);
+            depth++;
+        }
+        else if (c == ')' || c == '}')
+        {
+            lsrc_put(s, c);
+            depth--;
+        }
+        else
+        {
+            /// Atoms end at the first delimiter,
+            /// which is left to be read next.
+            for (; !lsrc_delim(c); c = getc(f))
+                lsrc_put(s, c);
+
+            ungetc(c, f);
+
+            if (depth == 0)
+                break;
+        }
+    }
+    while (depth > 0 && (c = getc(f)) != EOF);
+
+    s->data[s->pos] = '\0';
+    s->pos = 0;
+    return 1;
+}
+
+
+void lsrc_parallel(lsrc* s, lctx* c)
+{
+    /// The pool is only started for a source worth splitting.
+    if (s->mapped && c->workers > 1 && s->len > LSRC_CHUNK_SIZE)
+    {
+        s->pool = lctx_pool(c);
+        s->workers = c->workers;
+    }
+}
+
+
+/// A run of `count` whole forms parsed on the pool.
+typedef struct lsrc_chunk
+{
+    char* data;
+    int start;
+    int count;
+    lval* forms;
+} lsrc_chunk;
+
+
+static void lsrc_chunk_run(void* arg)
+{
+    lsrc_chunk* c = arg;
+    int pos = c->start;
+
+    c->forms = lval_sexpr();
+
+    for (int k = 0; k < c->count; k++)
+    {
+        lval* x = lval_read(c->data, &pos);
+        lval_add(c->forms, x);
+
+        if (x->type == LVAL_ERR)
+            break;
+    }
+}
+
+
+/// Frees the forms parsed ahead that were not taken.
+static void lsrc_drop(lsrc* s)
+{
+    for (int k = s->taken; k < s->ahead->count; k++)
+        lval_del(s->ahead->cell[k]);
+
+    s->ahead->count = 0;
+    lval_del(s->ahead);
+    s->ahead = NULL;
+}
+
+
+/// Splits the next window of `s` into a chunk per worker
+/// at form boundaries and parses them on the pool. Each
+/// chunk is queued as soon as it is found, so scanning
+/// for the next overlaps with parsing the previous.
+static void lsrc_batch(lsrc* s)
+{
+    lsrc_chunk* chunks = calloc(s->workers, sizeof(lsrc_chunk));
+    lpool_group g = { 0 };
+    int n = 0;
+
+    for (lval_read_skip(s->data, &s->pos); 
+         n < s->workers && s->data[s->pos] != '\0'; n++)
+    {
+        lsrc_chunk* c = &chunks[n];
+        c->data = s->data;
+        c->start = s->pos;
+
+        while (s->data[s->pos] != '\0' && s->pos - c->start < LSRC_CHUNK_SIZE)
+        {
+            lval_read_scan(s->data, &s->pos);
+            lval_read_skip(s->data, &s->pos);
+            c->count++;
+        }
+
+        lpool_submit(s->pool, &g, lsrc_chunk_run, NULL, c);
+    }
+
+    lpool_wait(s->pool, &g);
+
+    lval* ahead = lval_sexpr();
+
+    for (int k = 0; k < n; k++)
+    {
+        lval* forms = chunks[k].forms;
+
+        for (int j = 0; j < forms->count; j++)
+            lval_add(ahead, forms->cell[j]);
+
+        forms->count = 0;
+        lval_del(forms);
+    }
+
+    free(chunks);
+
+    if (s->ahead)
+        lsrc_drop(s);
+
+    s->ahead = ahead;
+    s->taken = 0;
+}
+
+
+/// Parses the next form out of the source text of `s`.
+static lval* lsrc_parse(lsrc* s)
+{
+    if (s->pool)
+    {
+        if (s->ahead == NULL || s->taken == s->ahead->count)
+            lsrc_batch(s);
+
+        if (s->taken == s->ahead->count)
+            return NULL;
+
+        lval* x = s->ahead->cell[s->taken];
+        s->ahead->cell[s->taken++] = NULL;
+        return x;
+    }
+
+    if (s->stream && !lsrc_fill(s))
+        return NULL;
+
+    lval_read_skip(s->data, &s->pos);
+
+    if (s->data[s->pos] == '\0')
+        return NULL;
+
+    return lval_read(s->data, &s->pos);
+}
+
+
+lval* lsrc_next(lsrc* s)
+{
+    if (s->cache)
+        return lcache_read(s->cache);
+
+    lval* x = lsrc_parse(s);
+
+    /// The entry is only kept once the whole
+    /// source has parsed and been recorded.
+    if (s->record && (x == NULL || x->type == LVAL_ERR || !lcache_write(s->record, x)))
+    {
+        lcache_close(s->record, x == NULL);
+        s->record = NULL;
+    }
+
+    return x;
+}
+
+
+void lsrc_close(lsrc* s)
+{
+    if (s->ahead)
+        lsrc_drop(s);
+
+    if (s->cache)
+        lcache_close(s->cache, 0);
+
+    if (s->record)
+        lcache_close(s->record, 0);
+
+#ifndef _WIN32
+    if (s->mapped)
+        munmap(s->data, s->len);
+    else
+#endif  /// _WIN32
+    if (s->stream)
+    {
+        fclose(s->stream);
+        free(s->data);
+    }
+
+    free(s);
+}
+
+
 ///////////////////////
 /// `lval` Printing ///
 ///////////////////////
 
-void lval_print(lval* v)
+void lval_write(lwriter* w, lval* v)
 {
     switch (v->type)
     {
         case LVAL_NUM:
-            printf("%li", v->num);
+            lwriter_num(w, v->num);
             break;
 
         case LVAL_ERR:
-            printf("Error: %s", v->err);
+            lwriter_puts(w, "Error: ");
+            lwriter_puts(w, v->err);
             break;
         
         case LVAL_SYM:
-            printf("%s", v->sym);
+            lwriter_puts(w, v->sym);
             break;
 
         case LVAL_STR:
-            lval_print_str(v);
+            lval_print_str(w, v);
             break;
 
         case LVAL_FUN:
             if (v->builtin)
-                printf("<builtin>");
+                lwriter_puts(w, "<builtin>");
             else
             {
-                printf("(\\ ");
-                lval_print(v->formals);
-                putchar(' ');
-                lval_print(v->body);
-                putchar(')');
+                lwriter_puts(w, "(\\ ");
+                lval_write(w, v->formals);
+                lwriter_putc(w, ' ');
+                lval_write(w, v->body);
+                lwriter_putc(w, ')');
             }
             break;
 
         case LVAL_SEXPR:
-            lval_expr_print(v, '(', ')');
+            lval_expr_print(w, v, '(', ')');
             break;
 
         case LVAL_QEXPR:
-            lval_expr_print(v, '{', '}');
+            lval_expr_print(w, v, '{', '}');
+            break;
+
+        case LVAL_SEQ:
+            lwriter_puts(w, "<seq>");
+            break;
+
+        case LVAL_FUT:
+            lwriter_puts(w, "<future>");
+            break;
+
+        case LVAL_ACTOR:
+            lwriter_puts(w, "<actor>");
+            break;
+
+        case LVAL_GEN:
+            lwriter_puts(w, "<generator>");
+            break;
+
+        case LVAL_MOD:
+            lwriter_puts(w, "<module ");
+            lwriter_puts(w, v->mod->path);
+            lwriter_putc(w, '>');
+            break;
+
+        case LVAL_ARR:
+            lwriter_putc(w, '[');
+
+            for (int i = 0; i < v->arr->count; i++)
+            {
+                lval_write(w, v->arr->items[i]);
+
+                if (i != v->arr->count - 1)
+                    lwriter_putc(w, ' ');
+            }
+
+            lwriter_putc(w, ']');
+            break;
+
+        case LVAL_MAP:
+            lwriter_puts(w, "#map");
+            lval_hamt_print(w, v, LHAMT_PAIRS);
+            break;
+
+        case LVAL_SET:
+            lwriter_puts(w, "#set");
+            lval_hamt_print(w, v, LHAMT_KEYS);
+            break;
+
+        case LVAL_RECUR:
+            lwriter_puts(w, "<recur>");
             break;
     }
 }
 
 
+void lval_fprint(FILE* out, lval* v)
+{
+    lwriter* w = lwriter_file(out);
+    lval_write(w, v);
+    lwriter_close(w);
+}
+
+
+void lval_fprintln(FILE* out, lval* v)
+{
+    lwriter* w = lwriter_file(out);
+    lval_write(w, v);
+    lwriter_putc(w, '\n');
+    lwriter_close(w);
+}
+
+
+void lval_print(lval* v)
+{
+    lval_fprint(stdout, v);
+}
+
+
 void lval_println(lval* v)
 {
-    lval_print(v);
-    putchar('\n');
+    lval_fprintln(stdout, v);
+}
+
+
+char* lval_show(lval* v)
+{
+    lwriter* w = lwriter_str();
+    lval_write(w, v);
+    return lwriter_take(w);
 }
 
 
@@ -63,19 +530,27 @@ void lval_println(lval* v)
 /// Expression Printing ///
 ///////////////////////////
 
-void lval_expr_print(lval* v, char open, char close)
+void lval_expr_print(lwriter* w, lval* v, char open, char close)
 {
-    putchar(open);
+    lwriter_putc(w, open);
 
     for (int i = 0; i < v->count; i++)
     {
-        lval_print(v->cell[i]);
+        lval_write(w, v->cell[i]);
 
         if (i != v->count - 1)
-            putchar(' ');
+            lwriter_putc(w, ' ');
     }
 
-    putchar(close);
+    lwriter_putc(w, close);
+}
+
+
+void lval_hamt_print(lwriter* w, lval* v, int part)
+{
+    lval* q = lhamt_collect(v->hamt, part);
+    lval_expr_print(w, q, '{', '}');
+    lval_del(q);
 }
 
 
@@ -83,15 +558,21 @@ void lval_expr_print(lval* v, char open, char close)
 /// String IO ///
 /////////////////
 
-void lval_print_str(lval* v)
+void lval_print_str(lwriter* w, lval* v)
 {
-    putchar('"');
+    lwriter_putc(w, '"');
 
-    for (int i = 0; i < strlen(v->str); i++)
-        if (strchr("\a\b\f\n\r\t\v\\\'\"", v->str[i]))
-            printf("%s", lval_str_escape(v->str[i]));
-        else
-            putchar(v->str[i]);
+    /// Runs of characters needing no escape are
+    /// written in one go.
+    for (char* s = v->str; *s; )
+    {
+        long n = strcspn(s, "\a\b\f\n\r\t\v\\\'\"");
+        lwriter_put(w, s, n);
+        s += n;
+
+        if (*s)
+            lwriter_puts(w, lval_str_escape(*s++));
+    }
 
-    putchar('"');
+    lwriter_putc(w, '"');
 }
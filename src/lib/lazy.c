@@ -0,0 +1,198 @@
+/// Recursive mutexes are an XSI interface.
+#define _XOPEN_SOURCE 700
+
+#include <lazy.h>
+#include <builtins.h>
+#include <ctx.h>
+#include <io.h>
+#include <lenv.h>
+#include <lval.h>
+#include <parser.h>
+#include <utilities.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+
+/// Finds the name a top-level form at `s` defines, if
+/// it is of the shape `(fun {name ...} ...)` or
+/// `(def {name} ...)`. Stores the span of the name in
+/// `name` and `len` and returns 1, or returns 0.
+static int llazy_name(char* s, char** name, int* len)
+{
+    int i = 0;
+
+    if (s[i++] != '(')
+        return 0;
+
+    lval_read_skip(s, &i);
+
+    /// The head is read whole so `define` or `funcall`
+    /// are not taken for `def` or `fun`.
+    int head = i;
+    lval_read_scan(s, &i);
+
+    if (i - head != 3)
+        return 0;
+
+    int fun = strncmp(s + head, "fun", 3) == 0;
+
+    if (!fun && strncmp(s + head, "def", 3) != 0)
+        return 0;
+
+    lval_read_skip(s, &i);
+
+    if (s[i++] != '{')
+        return 0;
+
+    lval_read_skip(s, &i);
+
+    int start = i;
+    lval_read_scan(s, &i);
+
+    /// A definition binding several names (or a name
+    /// that is not a symbol) is not indexed.
+    if (i == start || s[start] == '(' || s[start] == '{' || s[start] == '"')
+        return 0;
+
+    *name = s + start;
+    *len = i - start;
+
+    lval_read_skip(s, &i);
+    return fun || s[i] == '}';
+}
+
+
+/// Parses and evaluates the form at `start` of `l`
+/// in the global environment of the instance owning `e`.
+static void llazy_eval(llazy* l, lenv* e, int start)
+{
+    int pos = start;
+    lval* expr = lval_read(l->data, &pos);
+
+    if (expr->type != LVAL_ERR)
+    {
+        /// Evaluated in a scope of its own so the calls
+        /// made count against the context that missed.
+        lenv* scope = lenv_child(e->ctx->owner->env);
+        scope->ctx = e->ctx;
+
+        expr = lval_eval(scope, expr);
+        lenv_del(scope);
+    }
+
+    if (expr->type == LVAL_ERR)
+        lval_fprintln(lctx_out(e), expr);
+
+    lval_del(expr);
+}
+
+
+////////////////////////////
+/// `llazy` Constructors ///
+////////////////////////////
+
+lval* llazy_load(lenv* e, char* path)
+{
+    if (e->ctx == NULL || e->ctx->owner->lazy != NULL)
+        return builtin_load(e, lval_add(lval_sexpr(), lval_str(path)));
+
+    long len;
+    char* data = lix_read_file(path, &len);
+
+    if (data == NULL)
+        return lval_err("Could not load library %s", path);
+
+    llazy* l = malloc(sizeof(llazy));
+    l->data = data;
+    l->count = 0;
+    l->syms = NULL;
+    l->starts = NULL;
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&l->lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    e->ctx->owner->lazy = l;
+
+    int pos = 0;
+
+    for (lval_read_skip(data, &pos); data[pos] != '\0'; lval_read_skip(data, &pos))
+    {
+        int start = pos;
+        char* name;
+        int n;
+
+        lval_read_scan(data, &pos);
+
+        if (!llazy_name(data + start, &name, &n))
+        {
+            llazy_eval(l, e, start);
+            continue;
+        }
+
+        pthread_mutex_lock(&l->lock);
+
+        l->count++;
+        l->syms = realloc(l->syms, sizeof(char*) * l->count);
+        l->starts = realloc(l->starts, sizeof(int) * l->count);
+
+        l->syms[l->count - 1] = strncpy(malloc(n + 1), name, n);
+        l->syms[l->count - 1][n] = '\0';
+        l->starts[l->count - 1] = start;
+
+        pthread_mutex_unlock(&l->lock);
+    }
+
+    return lval_sexpr();
+}
+
+
+void llazy_del(llazy* l)
+{
+    for (int i = 0; i < l->count; i++)
+        free(l->syms[i]);
+
+    free(l->syms);
+    free(l->starts);
+    free(l->data);
+    pthread_mutex_destroy(&l->lock);
+    free(l);
+}
+
+
+///////////////////////
+/// `llazy` Methods ///
+///////////////////////
+
+int llazy_resolve(lenv* e, char* name)
+{
+    llazy* l = e->ctx ? e->ctx->owner->lazy : NULL;
+
+    if (l == NULL)
+        return 0;
+
+    int found = 0;
+
+    pthread_mutex_lock(&l->lock);
+
+    for (int i = 0; i < l->count; i++)
+    {
+        if (strcmp(l->syms[i], name) != 0)
+            continue;
+
+        found = 1;
+
+        if (l->starts[i] < 0)
+            continue;
+
+        int start = l->starts[i];
+        l->starts[i] = -1;
+        llazy_eval(l, e, start);
+    }
+
+    pthread_mutex_unlock(&l->lock);
+    return found;
+}
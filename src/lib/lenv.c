@@ -1,6 +1,9 @@
 #include <builtins.h>
+#include <heap.h>
 #include <lenv.h>
 #include <lval.h>
+#include <lazy.h>
+#include <module.h>
 
 #include <stdlib.h>
 #include <string.h>
@@ -15,11 +18,25 @@ lenv* lenv_new(void)
     lenv* e = malloc(sizeof(lenv));
 
     e->par = NULL;
+    e->ctx = NULL;
+    e->root = 0;
 
     e->count = 0;
     e->syms = NULL;
     e->vals = NULL;
 
+    e->index = NULL;
+    e->slots = 0;
+
+    return e;
+}
+
+
+lenv* lenv_child(lenv* par)
+{
+    lenv* e = lenv_new();
+    e->par = par;
+    e->ctx = par->ctx;
     return e;
 }
 
@@ -30,16 +47,20 @@ lenv* lenv_new(void)
 
 void lenv_del(lenv* e)
 {
-    for (int i = 0; i < e->count; i++)
+    /// Unbinds each value before freeing it as closing a
+    /// generator may still look symbols up in `e`.
+    while (e->count)
     {
-        free(e->syms[i]);
-        lval_del(e->vals[i]);
+        e->count--;
+        free(e->syms[e->count]);
+        lval_del(e->vals[e->count]);
     }
 
     e->par = NULL;
 
     free(e->syms);
     free(e->vals);
+    free(e->index);
     free(e);
 }
 
@@ -48,42 +69,223 @@ void lenv_del(lenv* e)
 /// `lenv` Methods ///
 //////////////////////
 
-lval* lenv_get(lenv* e, lval* k)
+static unsigned long lenv_hash(const char* s)
+{
+    unsigned long h = 14695981039346656037UL;
+
+    for (; *s; s++)
+        h = (h ^ (unsigned char)*s) * 1099511628211UL;
+
+    return h;
+}
+
+
+/// Adds the binding at position `i` of `e` to its index.
+static void lenv_index_add(lenv* e, int i)
 {
+    int mask = e->slots - 1;
+    int j = (int)(lenv_hash(e->syms[i]) & mask);
+
+    while (e->index[j])
+        j = (j + 1) & mask;
+
+    e->index[j] = i + 1;
+}
+
+
+/// Rebuilds the index of `e` with room for its bindings
+/// to double, once it holds enough to need one.
+static void lenv_index_build(lenv* e)
+{
+    if (e->count < LENV_INDEX_MIN)
+        return;
+
+    free(e->index);
+
+    e->slots = 64;
+
+    while (e->slots < e->count * 4)
+        e->slots *= 2;
+
+    e->index = calloc(e->slots, sizeof(int));
+
     for (int i = 0; i < e->count; i++)
-        if (strcmp(e->syms[i], k->sym) == 0)
-            return lval_copy(e->vals[i]);
-    
-    if (e->par)
-        return lenv_get(e->par, k);
-    else
-        return lval_err("Unbound symbol '%s'", k->sym);
+        lenv_index_add(e, i);
+}
+
+
+/// Returns the position of `sym` in `e`, or -1.
+static int lenv_lookup(lenv* e, const char* sym)
+{
+    if (e->index == NULL)
+    {
+        for (int i = 0; i < e->count; i++)
+            if (strcmp(e->syms[i], sym) == 0)
+                return i;
+
+        return -1;
+    }
+
+    int mask = e->slots - 1;
+
+    /// Positions past `count` are of bindings lenv_del
+    /// has already freed.
+    for (int j = (int)(lenv_hash(sym) & mask); e->index[j]; j = (j + 1) & mask)
+    {
+        int i = e->index[j] - 1;
+
+        if (i < e->count && strcmp(e->syms[i], sym) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+
+/// Returns whether `e` is the global environment of an
+/// instance that has started threads, which may read it
+/// while its owner writes.
+static int lenv_shared(lenv* e)
+{
+    return e->par == NULL && e->ctx != NULL && e->ctx->threaded;
+}
+
+
+/// Returns a copy of the value bound to `k` in `e` or
+/// its enclosing environments, or NULL if it is unbound.
+static lval* lenv_find(lenv* e, lval* k)
+{
+    lval* v = NULL;
+
+    for (; e && !v; e = e->par)
+    {
+        int shared = lenv_shared(e);
+
+        if (shared)
+            pthread_rwlock_rdlock(&e->ctx->lock);
+
+        int i = lenv_lookup(e, k->sym);
+
+        if (i >= 0)
+            v = lval_copy(e->vals[i]);
+
+        if (shared)
+            pthread_rwlock_unlock(&e->ctx->lock);
+    }
+
+    return v;
+}
+
+
+lval* lenv_local(lenv* e, lval* k)
+{
+    int shared = lenv_shared(e);
+
+    if (shared)
+        pthread_rwlock_rdlock(&e->ctx->lock);
+
+    int i = lenv_lookup(e, k->sym);
+    lval* v = (i >= 0) ? lval_copy(e->vals[i]) : NULL;
+
+    if (shared)
+        pthread_rwlock_unlock(&e->ctx->lock);
+
+    return v;
+}
+
+
+lval* lenv_get(lenv* e, lval* k)
+{
+    lval* v = lenv_find(e, k);
+
+    if (v == NULL && llazy_resolve(e, k->sym))
+        v = lenv_find(e, k);
+
+    if (v == NULL)
+        v = lmod_resolve(e, k->sym);
+
+    return v ? v : lval_err("Unbound symbol '%s'", k->sym);
 }
 
 
 void lenv_put(lenv* e, lval* k, lval* v)
 {
-    for (int i = 0; i < e->count; i++)
-        if (strcmp(e->syms[i], k->sym) == 0)
-        {
-            lval_del(e->vals[i]);
-            e->vals[i] = lval_copy(v);
-            return;
-        }
+    int shared = lenv_shared(e);
+
+    if (shared)
+        pthread_rwlock_wrlock(&e->ctx->lock);
+
+    int i = lenv_lookup(e, k->sym);
+    lval* old = NULL;
+
+    if (i >= 0)
+        old = e->vals[i];
+    else
+    {
+        i = e->count++;
+        e->vals = realloc(e->vals, sizeof(lval*) * e->count);
+        e->syms = realloc(e->syms, sizeof(char*) * e->count);
+
+        e->syms[i] = malloc(strlen(k->sym) + 1);
+        strcpy(e->syms[i], k->sym);
+
+        if (e->count * 2 > e->slots)
+            lenv_index_build(e);
+        else
+            lenv_index_add(e, i);
+    }
+
+    e->vals[i] = lval_copy(v);
 
-    e->count++;
-    e->vals = realloc(e->vals, sizeof(lval*) * e->count);
-    e->syms = realloc(e->syms, sizeof(char*) * e->count);
+    if (shared)
+        pthread_rwlock_unlock(&e->ctx->lock);
 
-    e->vals[e->count - 1] = lval_copy(v);
-    e->syms[e->count - 1] = malloc(strlen(k->sym) + 1);
-    strcpy(e->syms[e->count - 1], k->sym);
+    /// Freed unlocked as closing a generator evaluates code.
+    if (old)
+        lval_del(old);
+}
+
+
+lval* lenv_take(lenv* e, lval* k)
+{
+    int shared = lenv_shared(e);
+
+    if (shared)
+        pthread_rwlock_wrlock(&e->ctx->lock);
+
+    int i = lenv_lookup(e, k->sym);
+    lval* v = NULL;
+
+    if (i >= 0)
+    {
+        v = e->vals[i];
+        free(e->syms[i]);
+
+        e->count--;
+        memmove(&e->syms[i], &e->syms[i + 1], sizeof(char*) * (e->count - i));
+        memmove(&e->vals[i], &e->vals[i + 1], sizeof(lval*) * (e->count - i));
+
+        /// Every binding after `i` has moved.
+        free(e->index);
+        e->index = NULL;
+        e->slots = 0;
+        lenv_index_build(e);
+    }
+
+    if (shared)
+        pthread_rwlock_unlock(&e->ctx->lock);
+
+    return v;
 }
 
 lenv* lenv_copy(lenv* e)
 {
+    LHEAP_ENV_COPIED(e);
+
     lenv* n = malloc(sizeof(lenv));
     n->par = e->par;
+    n->ctx = e->ctx;
+    n->root = e->root;
     n->count = e->count;
 
     n->syms = malloc(sizeof(char*) * n->count);
@@ -95,14 +297,46 @@ lenv* lenv_copy(lenv* e)
         strcpy(n->syms[i], e->syms[i]);
         n->vals[i] = lval_copy(e->vals[i]);
     }
+
+    n->index = NULL;
+    n->slots = 0;
+    lenv_index_build(n);
     
     return n;
 }
 
 
+lenv* lenv_snapshot(lenv* e)
+{
+    lenv* n = lenv_new();
+    lctx* c = e->ctx;
+
+    for (; e->par; e = e->par)
+        for (int i = 0; i < e->count; i++)
+        {
+            int bound = 0;
+
+            for (int j = 0; j < n->count && !bound; j++)
+                bound = strcmp(n->syms[j], e->syms[i]) == 0;
+
+            if (!bound)
+            {
+                lval* k = lval_sym(e->syms[i]);
+                lenv_put(n, k, e->vals[i]);
+                lval_del(k);
+            }
+        }
+
+    n->par = e;
+    n->ctx = c;
+    n->root = 1;
+    return n;
+}
+
+
 void lenv_def(lenv* e, lval* k, lval* v)
 {
-    while (e->par)
+    while (e->par && !e->root)
         e = e->par;
 
     lenv_put(e, k, v);
@@ -148,4 +382,76 @@ void lenv_add_builtins(lenv* e)
     lenv_add_builtin(e, "<", builtin_lt);
     lenv_add_builtin(e, ">=", builtin_ge);
     lenv_add_builtin(e, "<=", builtin_le);
+
+    lenv_add_builtin(e, "loop", builtin_loop);
+    lenv_add_builtin(e, "recur", builtin_recur);
+    lenv_add_builtin(e, "while", builtin_while);
+    lenv_add_builtin(e, "for-each", builtin_for_each);
+    lenv_add_builtin(e, "dotimes", builtin_dotimes);
+
+    lenv_add_builtin(e, "show", builtin_show);
+    lenv_add_builtin(e, "to-string", builtin_to_string);
+
+    lenv_add_builtin(e, "range", builtin_range);
+    lenv_add_builtin(e, "seq", builtin_seq);
+    lenv_add_builtin(e, "seq-map", builtin_seq_map);
+    lenv_add_builtin(e, "seq-filter", builtin_seq_filter);
+    lenv_add_builtin(e, "seq-take", builtin_seq_take);
+    lenv_add_builtin(e, "seq-take-while", builtin_seq_take_while);
+    lenv_add_builtin(e, "fold", builtin_fold);
+    lenv_add_builtin(e, "collect", builtin_collect);
+
+    lenv_add_builtin(e, "make-array", builtin_make_array);
+    lenv_add_builtin(e, "aget", builtin_aget);
+    lenv_add_builtin(e, "aset!", builtin_aset);
+    lenv_add_builtin(e, "push!", builtin_push);
+    lenv_add_builtin(e, "alen", builtin_alen);
+    lenv_add_builtin(e, "freeze", builtin_freeze);
+    lenv_add_builtin(e, "thaw", builtin_thaw);
+
+    lenv_add_builtin(e, "hash-map", builtin_hash_map);
+    lenv_add_builtin(e, "hash-set", builtin_hash_set);
+    lenv_add_builtin(e, "insert", builtin_insert);
+    lenv_add_builtin(e, "remove", builtin_remove);
+    lenv_add_builtin(e, "get", builtin_get);
+    lenv_add_builtin(e, "contains", builtin_contains);
+    lenv_add_builtin(e, "keys", builtin_keys);
+    lenv_add_builtin(e, "vals", builtin_vals);
+    lenv_add_builtin(e, "size", builtin_size);
+
+    lenv_add_builtin(e, "sort", builtin_sort);
+    lenv_add_builtin(e, "sort-by", builtin_sort_by);
+    lenv_add_builtin(e, "binary-search", builtin_binary_search);
+
+    lenv_add_builtin(e, "pmap", builtin_pmap);
+    lenv_add_builtin(e, "pfilter", builtin_pfilter);
+    lenv_add_builtin(e, "preduce", builtin_preduce);
+    lenv_add_builtin(e, "parallel-config", builtin_parallel_config);
+    lenv_add_builtin(e, "spawn", builtin_spawn);
+    lenv_add_builtin(e, "await", builtin_await);
+
+    lenv_add_builtin(e, "actor", builtin_actor);
+    lenv_add_builtin(e, "send", builtin_send);
+    lenv_add_builtin(e, "receive", builtin_receive);
+    lenv_add_builtin(e, "actor-stats", builtin_actor_stats);
+
+    lenv_add_builtin(e, "generator", builtin_generator);
+    lenv_add_builtin(e, "yield", builtin_yield);
+    lenv_add_builtin(e, "next", builtin_next);
+
+    lenv_add_builtin(e, "io-open", builtin_io_open);
+    lenv_add_builtin(e, "io-listen", builtin_io_listen);
+    lenv_add_builtin(e, "io-connect", builtin_io_connect);
+    lenv_add_builtin(e, "io-close", builtin_io_close);
+    lenv_add_builtin(e, "io-read", builtin_io_read);
+    lenv_add_builtin(e, "io-accept", builtin_io_accept);
+    lenv_add_builtin(e, "io-write", builtin_io_write);
+    lenv_add_builtin(e, "io-timer", builtin_io_timer);
+    lenv_add_builtin(e, "io-run", builtin_io_run);
+
+    lenv_add_builtin(e, "require", builtin_require);
+    lenv_add_builtin(e, "import", builtin_import);
+    lenv_add_builtin(e, "export", builtin_export);
+
+    lenv_add_builtin(e, "heap-stats", builtin_heap_stats);
 }
@@ -0,0 +1,708 @@
+#include <loop.h>
+#include <lval.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/// A queued write and the callback to run once it is done.
+typedef struct lwrite
+{
+    char* data;
+    size_t len;
+    size_t pos;
+    lval* done;
+
+    struct lwrite* next;
+} lwrite;
+
+
+/// Everything registered for one descriptor.
+///
+/// Regular files cannot be added to an epoll set; they are
+/// marked `always` and treated as permanently ready.
+typedef struct lwatch
+{
+    int fd;
+    int always;
+    unsigned int events;
+
+    lval* reader;
+    lval* acceptor;
+
+    lwrite* head;
+    lwrite* tail;
+} lwatch;
+
+
+/// A pending timer, kept in a list sorted by `due`.
+typedef struct ltimer
+{
+    long long due;
+    lval* func;
+
+    struct ltimer* next;
+} ltimer;
+
+
+struct lloop
+{
+    int epfd;
+    pthread_t thread;
+
+    lwatch** fds;
+    int cap;
+
+    ltimer* timers;
+};
+
+
+static long long lloop_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+
+static lval* lloop_errno(char* what)
+{
+    return lval_err("%s failed: %s", what, strerror(errno));
+}
+
+
+////////////////////////
+/// `lwatch` Methods ///
+////////////////////////
+
+static lwatch* lloop_find(lloop* l, int fd)
+{
+    return (fd >= 0 && fd < l->cap) ? l->fds[fd] : NULL;
+}
+
+
+/// Starts watching `fd`, which is made non-blocking.
+static lwatch* lloop_add(lloop* l, int fd)
+{
+    if (fd >= l->cap)
+    {
+        int cap = l->cap;
+
+        while (cap <= fd)
+            cap *= 2;
+
+        l->fds = realloc(l->fds, sizeof(lwatch*) * cap);
+        memset(l->fds + l->cap, 0, sizeof(lwatch*) * (cap - l->cap));
+        l->cap = cap;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    lwatch* w = calloc(1, sizeof(lwatch));
+    w->fd = fd;
+
+    struct epoll_event ev = { 0 };
+    ev.data.fd = fd;
+
+    if (epoll_ctl(l->epfd, EPOLL_CTL_ADD, fd, &ev) != 0 && errno == EPERM)
+        w->always = 1;
+
+    l->fds[fd] = w;
+    return w;
+}
+
+
+/// Re-arms `w` for whatever it is currently interested in.
+static void lloop_arm(lloop* l, lwatch* w)
+{
+    if (w->always)
+        return;
+
+    unsigned int events = 0;
+
+    if (w->reader || w->acceptor)
+        events |= EPOLLIN;
+
+    if (w->head)
+        events |= EPOLLOUT;
+
+    if (events == w->events)
+        return;
+
+    struct epoll_event ev = { 0 };
+    ev.events = events;
+    ev.data.fd = w->fd;
+
+    epoll_ctl(l->epfd, EPOLL_CTL_MOD, w->fd, &ev);
+    w->events = events;
+}
+
+
+static void lloop_forget(lloop* l, lwatch* w)
+{
+    if (!w->always)
+        epoll_ctl(l->epfd, EPOLL_CTL_DEL, w->fd, NULL);
+
+    l->fds[w->fd] = NULL;
+
+    if (w->reader)
+        lval_del(w->reader);
+
+    if (w->acceptor)
+        lval_del(w->acceptor);
+
+    while (w->head)
+    {
+        lwrite* x = w->head;
+        w->head = x->next;
+
+        if (x->done)
+            lval_del(x->done);
+
+        free(x->data);
+        free(x);
+    }
+
+    close(w->fd);
+    free(w);
+}
+
+
+/// Returns `fd` as a Number or an error if it failed.
+static lval* lloop_track(lloop* l, int fd, char* what)
+{
+    if (fd < 0)
+        return lloop_errno(what);
+
+    lloop_add(l, fd);
+    return lval_num(fd);
+}
+
+
+////////////////////////////
+/// `lloop` Constructors ///
+////////////////////////////
+
+lloop* lloop_new(void)
+{
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (epfd < 0)
+        return NULL;
+
+    lloop* l = malloc(sizeof(lloop));
+    l->epfd = epfd;
+    l->thread = pthread_self();
+    l->cap = 16;
+    l->fds = calloc(l->cap, sizeof(lwatch*));
+    l->timers = NULL;
+    return l;
+}
+
+
+void lloop_del(lloop* l)
+{
+    for (int i = 0; i < l->cap; i++)
+        if (l->fds[i])
+            lloop_forget(l, l->fds[i]);
+
+    while (l->timers)
+    {
+        ltimer* t = l->timers;
+        l->timers = t->next;
+        lval_del(t->func);
+        free(t);
+    }
+
+    close(l->epfd);
+    free(l->fds);
+    free(l);
+}
+
+
+///////////////////////////
+/// `lloop` Descriptors ///
+///////////////////////////
+
+lval* lloop_open(lloop* l, char* path, char* mode)
+{
+    int flags;
+
+    if (strcmp(mode, "r") == 0)
+        flags = O_RDONLY;
+    else if (strcmp(mode, "w") == 0)
+        flags = O_WRONLY | O_CREAT | O_TRUNC;
+    else if (strcmp(mode, "a") == 0)
+        flags = O_WRONLY | O_CREAT | O_APPEND;
+    else
+        return lval_err("Invalid mode \"%s\". Expected \"r\", \"w\" or \"a\".", mode);
+
+    return lloop_track(l, open(path, flags | O_CLOEXEC | O_NONBLOCK, 0644), "open");
+}
+
+
+/// Fills in `addr` for `path`, returning 0 if it is too long.
+static int lloop_addr(struct sockaddr_un* addr, char* path)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+
+    if (strlen(path) >= sizeof(addr->sun_path))
+        return 0;
+
+    strcpy(addr->sun_path, path);
+    return 1;
+}
+
+
+lval* lloop_listen(lloop* l, char* path)
+{
+    struct sockaddr_un addr;
+
+    if (!lloop_addr(&addr, path))
+        return lval_err("Socket path \"%s\" is too long.", path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return lloop_errno("socket");
+
+    unlink(path);
+
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        lval* err = lloop_errno("listen");
+        close(fd);
+        return err;
+    }
+
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return lloop_track(l, fd, "listen");
+}
+
+
+lval* lloop_connect(lloop* l, char* path)
+{
+    struct sockaddr_un addr;
+
+    if (!lloop_addr(&addr, path))
+        return lval_err("Socket path \"%s\" is too long.", path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return lloop_errno("socket");
+
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+    {
+        lval* err = lloop_errno("connect");
+        close(fd);
+        return err;
+    }
+
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return lloop_track(l, fd, "connect");
+}
+
+
+lval* lloop_close(lloop* l, int fd)
+{
+    lwatch* w = lloop_find(l, fd);
+
+    if (w == NULL)
+        return lval_err("Descriptor %i is not open.", fd);
+
+    lloop_forget(l, w);
+    return lval_sexpr();
+}
+
+
+///////////////////////
+/// `lloop` Methods ///
+///////////////////////
+
+lval* lloop_read(lloop* l, int fd, lval* f)
+{
+    lwatch* w = lloop_find(l, fd);
+
+    if (w == NULL)
+    {
+        lval_del(f);
+        return lval_err("Descriptor %i is not open.", fd);
+    }
+
+    if (w->reader)
+        lval_del(w->reader);
+
+    w->reader = f;
+    lloop_arm(l, w);
+    return lval_sexpr();
+}
+
+
+lval* lloop_accept(lloop* l, int fd, lval* f)
+{
+    lwatch* w = lloop_find(l, fd);
+
+    if (w == NULL)
+    {
+        lval_del(f);
+        return lval_err("Descriptor %i is not open.", fd);
+    }
+
+    if (w->acceptor)
+        lval_del(w->acceptor);
+
+    w->acceptor = f;
+    lloop_arm(l, w);
+    return lval_sexpr();
+}
+
+
+/// Calls `f` in `e` with the arguments `a`, consuming
+/// both, and returns an error if it fails.
+static lval* lloop_call(lenv* e, lval* f, lval* a)
+{
+    lval* r = lval_apply(e, f, a);
+    lval_del(f);
+
+    if (r->type == LVAL_ERR)
+        return r;
+
+    lval_del(r);
+    return NULL;
+}
+
+
+/// Writes to `fd` as write does, but failing with EPIPE
+/// rather than raising SIGPIPE if the other end is closed,
+/// without changing how the process handles SIGPIPE.
+static ssize_t lloop_send(int fd, char* data, size_t len)
+{
+    ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+
+    if (n >= 0 || errno != ENOTSOCK)
+        return n;
+
+    /// Pipes have no MSG_NOSIGNAL, so SIGPIPE is blocked on
+    /// this thread for the write and any it raised dropped.
+    sigset_t pipe, old;
+    sigemptyset(&pipe);
+    sigaddset(&pipe, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe, &old);
+
+    n = write(fd, data, len);
+
+    if (n < 0 && errno == EPIPE)
+    {
+        struct timespec now = { 0, 0 };
+        sigtimedwait(&pipe, NULL, &now);
+        errno = EPIPE;
+    }
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    return n;
+}
+
+
+/// Writes out the queue of `w` as far as it will go,
+/// running the callbacks of finished writes. `w` may be
+/// closed by a callback.
+static lval* lloop_flush(lloop* l, lenv* e, lwatch* w, int* ran)
+{
+    int fd = w->fd;
+
+    while ((w = lloop_find(l, fd)) && w->head)
+    {
+        lwrite* x = w->head;
+        ssize_t n = lloop_send(fd, x->data + x->pos, x->len - x->pos);
+
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+
+        if (n < 0)
+            return lloop_errno("write");
+
+        x->pos += n;
+
+        if (x->pos < x->len)
+            continue;
+
+        w->head = x->next;
+
+        if (w->head == NULL)
+            w->tail = NULL;
+
+        lval* done = x->done;
+        long len = x->len;
+
+        free(x->data);
+        free(x);
+
+        if (done)
+        {
+            (*ran)++;
+            lval* err = lloop_call(e, done, lval_add(lval_sexpr(), lval_num(len)));
+
+            if (err)
+                return err;
+        }
+    }
+
+    if (w)
+        lloop_arm(l, w);
+
+    return NULL;
+}
+
+
+lval* lloop_write(lloop* l, int fd, char* s, lval* f)
+{
+    lwatch* w = lloop_find(l, fd);
+
+    if (w == NULL)
+    {
+        if (f)
+            lval_del(f);
+
+        return lval_err("Descriptor %i is not open.", fd);
+    }
+
+    lwrite* x = malloc(sizeof(lwrite));
+    x->len = strlen(s);
+    x->pos = 0;
+    x->data = malloc(x->len + 1);
+    memcpy(x->data, s, x->len + 1);
+    x->done = f;
+    x->next = NULL;
+
+    if (w->tail)
+        w->tail->next = x;
+    else
+        w->head = x;
+
+    w->tail = x;
+
+    lloop_arm(l, w);
+    return lval_sexpr();
+}
+
+
+void lloop_timer(lloop* l, long ms, lval* f)
+{
+    ltimer* t = malloc(sizeof(ltimer));
+    t->due = lloop_now() + (ms > 0 ? ms : 0);
+    t->func = f;
+
+    ltimer** at = &l->timers;
+
+    while (*at && (*at)->due <= t->due)
+        at = &(*at)->next;
+
+    t->next = *at;
+    *at = t;
+}
+
+
+/// Reads what is available on `w` into its reader.
+static lval* lloop_drain(lloop* l, lenv* e, lwatch* w, int* ran)
+{
+    static _Thread_local char buffer[LLOOP_CHUNK];
+
+    ssize_t n = read(w->fd, buffer, LLOOP_CHUNK);
+
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        return NULL;
+
+    if (n < 0)
+        return lloop_errno("read");
+
+    lval* f = lval_copy(w->reader);
+
+    if (n == 0)
+    {
+        lval_del(w->reader);
+        w->reader = NULL;
+        lloop_arm(l, w);
+    }
+
+    (*ran)++;
+    return lloop_call(e, f, lval_add(lval_sexpr(), lval_str_n(buffer, n)));
+}
+
+
+/// Accepts every pending connection on `w`.
+static lval* lloop_take(lloop* l, lenv* e, lwatch* w, int* ran)
+{
+    int fd = w->fd;
+
+    while ((w = lloop_find(l, fd)) && w->acceptor)
+    {
+        int conn = accept(fd, NULL, NULL);
+
+        if (conn < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return NULL;
+
+        if (conn < 0)
+            return lloop_errno("accept");
+
+        fcntl(conn, F_SETFD, FD_CLOEXEC);
+        lloop_add(l, conn);
+
+        (*ran)++;
+        lval* err = lloop_call(e, lval_copy(w->acceptor), 
+                               lval_add(lval_sexpr(), lval_num(conn)));
+
+        if (err)
+            return err;
+    }
+
+    return NULL;
+}
+
+
+/// Handles whatever `fd` is ready for.
+static lval* lloop_dispatch(lloop* l, lenv* e, int fd, unsigned int events, int* ran)
+{
+    lval* err = NULL;
+    lwatch* w = lloop_find(l, fd);
+
+    if (w && w->acceptor && (events & EPOLLIN))
+        err = lloop_take(l, e, w, ran);
+    else if (w && w->reader && (events & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+        err = lloop_drain(l, e, w, ran);
+
+    if (err == NULL && (w = lloop_find(l, fd)) && w->head 
+        && (events & (EPOLLOUT | EPOLLHUP | EPOLLERR)))
+        err = lloop_flush(l, e, w, ran);
+
+    return err;
+}
+
+
+/// Returns whether anything is left to wait for, setting
+/// `ready` if some always-ready descriptor has work.
+static int lloop_pending(lloop* l, int* ready)
+{
+    int pending = l->timers != NULL;
+    *ready = 0;
+
+    for (int i = 0; i < l->cap; i++)
+    {
+        lwatch* w = l->fds[i];
+
+        if (w && (w->reader || w->acceptor || w->head))
+        {
+            pending = 1;
+            *ready |= w->always;
+        }
+    }
+
+    return pending;
+}
+
+
+lval* lloop_run(lloop* l, lenv* e, long ms)
+{
+    long long end = lloop_now() + ms;
+    int ran = 0;
+    int ready;
+
+    while (lloop_pending(l, &ready))
+    {
+        long long now = lloop_now();
+
+        if (ms >= 0 && now >= end)
+            break;
+
+        long long wait = (ms >= 0) ? end - now : -1;
+
+        if (l->timers && (wait < 0 || l->timers->due - now < wait))
+            wait = l->timers->due > now ? l->timers->due - now : 0;
+
+        if (ready)
+            wait = 0;
+
+        struct epoll_event evs[LLOOP_EVENTS];
+        int n = epoll_wait(l->epfd, evs, LLOOP_EVENTS, (int)wait);
+
+        if (n < 0 && errno != EINTR)
+            return lloop_errno("epoll_wait");
+
+        for (int i = 0; i < n; i++)
+        {
+            lval* err = lloop_dispatch(l, e, evs[i].data.fd, evs[i].events, &ran);
+
+            if (err)
+                return err;
+        }
+
+        for (int i = 0; ready && i < l->cap; i++)
+            if (l->fds[i] && l->fds[i]->always)
+            {
+                lval* err = lloop_dispatch(l, e, i, EPOLLIN | EPOLLOUT, &ran);
+
+                if (err)
+                    return err;
+            }
+
+        now = lloop_now();
+
+        while (l->timers && l->timers->due <= now)
+        {
+            ltimer* t = l->timers;
+            l->timers = t->next;
+
+            lval* f = t->func;
+            free(t);
+
+            ran++;
+            lval* err = lloop_call(e, f, lval_sexpr());
+
+            if (err)
+                return err;
+        }
+    }
+
+    return lval_num(ran);
+}
+
+
+int lloop_owned(lloop* l)
+{
+    return pthread_equal(l->thread, pthread_self());
+}
+
+
+#else
+
+
+lloop* lloop_new(void) { return NULL; }
+void lloop_del(lloop* l) {}
+
+lval* lloop_open(lloop* l, char* path, char* mode) { return NULL; }
+lval* lloop_listen(lloop* l, char* path) { return NULL; }
+lval* lloop_connect(lloop* l, char* path) { return NULL; }
+lval* lloop_close(lloop* l, int fd) { return NULL; }
+
+lval* lloop_read(lloop* l, int fd, lval* f) { return NULL; }
+lval* lloop_accept(lloop* l, int fd, lval* f) { return NULL; }
+lval* lloop_write(lloop* l, int fd, char* s, lval* f) { return NULL; }
+void lloop_timer(lloop* l, long ms, lval* f) {}
+lval* lloop_run(lloop* l, lenv* e, long ms) { return NULL; }
+int lloop_owned(lloop* l) { return 0; }
+
+
+#endif
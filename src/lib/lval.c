@@ -1,6 +1,18 @@
 #include <lval.h>
+#include <actor.h>
+#include <array.h>
 #include <builtins.h>
+#include <ctx.h>
+#include <future.h>
+#include <generator.h>
+#include <hamt.h>
+#include <heap.h>
+#include <image.h>
+#include <lazy.h>
 #include <lenv.h>
+#include <profile.h>
+#include <seq.h>
+#include <trace.h>
 #include <utilities.h>
 
 #include <stdarg.h>
@@ -13,10 +25,20 @@
 /// `lval` Constructors ///
 ///////////////////////////
 
-lval* lval_num(long x)
+/// Every lval is allocated here, so the heap counters
+/// see each one.
+static lval* lval_alloc(int type)
 {
     lval* v = malloc(sizeof(lval));
-    v->type = LVAL_NUM;
+    v->type = type;
+    LHEAP_ALLOC(type);
+    return v;
+}
+
+
+lval* lval_num(long x)
+{
+    lval* v = lval_alloc(LVAL_NUM);
     v->num = x;
     return v;
 }
@@ -24,8 +46,7 @@ lval* lval_num(long x)
 
 lval* lval_err(char* fmt, ...)
 {
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_ERR;
+    lval* v = lval_alloc(LVAL_ERR);
     
     va_list va;
     va_start(va, fmt);
@@ -42,8 +63,7 @@ lval* lval_err(char* fmt, ...)
 
 lval* lval_sym(char* s)
 {
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_SYM;
+    lval* v = lval_alloc(LVAL_SYM);
     v->sym = malloc(strlen(s) + 1);
     strcpy(v->sym, s);
     return v;
@@ -52,18 +72,36 @@ lval* lval_sym(char* s)
 
 lval* lval_str(char* s)
 {
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_STR;
+    lval* v = lval_alloc(LVAL_STR);
     v->str = malloc(strlen(s) + 1);
     strcpy(v->str, s);
     return v;
 }
 
 
+lval* lval_sym_n(char* s, int n)
+{
+    lval* v = lval_alloc(LVAL_SYM);
+    v->sym = malloc(n + 1);
+    memcpy(v->sym, s, n);
+    v->sym[n] = '\0';
+    return v;
+}
+
+
+lval* lval_str_n(char* s, int n)
+{
+    lval* v = lval_alloc(LVAL_STR);
+    v->str = malloc(n + 1);
+    memcpy(v->str, s, n);
+    v->str[n] = '\0';
+    return v;
+}
+
+
 lval* lval_sexpr(void)
 {
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_SEXPR;
+    lval* v = lval_alloc(LVAL_SEXPR);
     v->count = 0;
     v->cell = NULL;
     return v;
@@ -72,8 +110,7 @@ lval* lval_sexpr(void)
 
 lval* lval_qexpr(void)
 {
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_QEXPR;
+    lval* v = lval_alloc(LVAL_QEXPR);
     v->count = 0;
     v->cell = NULL;
     return v;
@@ -82,8 +119,7 @@ lval* lval_qexpr(void)
 
 lval* lval_fun(lbuiltin func)
 {
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_FUN;
+    lval* v = lval_alloc(LVAL_FUN);
     v->builtin = func;
     return v;
 }
@@ -91,8 +127,7 @@ lval* lval_fun(lbuiltin func)
 
 lval* lval_lambda(lval* formals, lval* body)
 {
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_FUN;
+    lval* v = lval_alloc(LVAL_FUN);
 
     v->builtin = NULL;
 
@@ -100,6 +135,74 @@ lval* lval_lambda(lval* formals, lval* body)
 
     v->formals = formals;
     v->body = body;
+    v->home = NULL;
+    v->sym = NULL;
+    return v;
+}
+
+
+lval* lval_seq(lseq* s)
+{
+    lval* v = lval_alloc(LVAL_SEQ);
+    v->seq = s;
+    return v;
+}
+
+
+lval* lval_arr(larr* a)
+{
+    lval* v = lval_alloc(LVAL_ARR);
+    v->arr = a;
+    return v;
+}
+
+
+lval* lval_fut(lfut* f)
+{
+    lval* v = lval_alloc(LVAL_FUT);
+    v->fut = f;
+    return v;
+}
+
+
+lval* lval_actor(lactor* a)
+{
+    lval* v = lval_alloc(LVAL_ACTOR);
+    v->actor = a;
+    return v;
+}
+
+
+lval* lval_gen(lgen* g)
+{
+    lval* v = lval_alloc(LVAL_GEN);
+    v->gen = g;
+    return v;
+}
+
+
+lval* lval_mod(lmod* m)
+{
+    lval* v = lval_alloc(LVAL_MOD);
+    v->mod = m;
+    return v;
+}
+
+
+lval* lval_map(lhamt* root, int count)
+{
+    lval* v = lval_alloc(LVAL_MAP);
+    v->hamt = root;
+    v->count = count;
+    return v;
+}
+
+
+lval* lval_set(lhamt* root, int count)
+{
+    lval* v = lval_alloc(LVAL_SET);
+    v->hamt = root;
+    v->count = count;
     return v;
 }
 
@@ -133,11 +236,42 @@ void lval_del(lval* v)
                 lenv_del(v->env);
                 lval_del(v->formals);
                 lval_del(v->body);
+                free(v->sym);
             }
             break;
 
+        case LVAL_SEQ:
+            lseq_unref(v->seq);
+            break;
+
+        case LVAL_ARR:
+            larr_unref(v->arr);
+            break;
+
+        case LVAL_FUT:
+            lfut_unref(v->fut);
+            break;
+
+        case LVAL_ACTOR:
+            lactor_unref(v->actor);
+            break;
+
+        case LVAL_GEN:
+            lgen_unref(v->gen);
+            break;
+
+        /// Modules belong to the instance that loaded them.
+        case LVAL_MOD:
+            break;
+
+        case LVAL_MAP:
+        case LVAL_SET:
+            lhamt_unref(v->hamt);
+            break;
+
         case LVAL_QEXPR:
         case LVAL_SEXPR:
+        case LVAL_RECUR:
             for (int i = 0; i < v->count; i++)
                 lval_del(v->cell[i]);
 
@@ -145,6 +279,7 @@ void lval_del(lval* v)
             break;
     }
 
+    LHEAP_FREE(v->type);
     free(v);
 }
 
@@ -164,8 +299,7 @@ lval* lval_add(lval* v, lval* x)
 
 lval* lval_copy(lval* v)
 {
-    lval* x = malloc(sizeof(lval));
-    x->type = v->type;
+    lval* x = lval_alloc(v->type);
 
     switch (v->type)
     {
@@ -178,6 +312,14 @@ lval* lval_copy(lval* v)
                 x->env = lenv_copy(v->env);
                 x->formals = lval_copy(v->formals);
                 x->body = lval_copy(v->body);
+                x->home = v->home;
+                x->sym = NULL;
+
+                if (v->sym)
+                {
+                    x->sym = malloc(strlen(v->sym) + 1);
+                    strcpy(x->sym, v->sym);
+                }
             }
             break;
 
@@ -200,8 +342,39 @@ lval* lval_copy(lval* v)
             strcpy(x->str, v->str);
             break;
 
+        case LVAL_SEQ:
+            x->seq = lseq_ref(v->seq);
+            break;
+
+        case LVAL_ARR:
+            x->arr = larr_ref(v->arr);
+            break;
+
+        case LVAL_FUT:
+            x->fut = lfut_ref(v->fut);
+            break;
+
+        case LVAL_ACTOR:
+            x->actor = lactor_ref(v->actor);
+            break;
+
+        case LVAL_GEN:
+            x->gen = lgen_ref(v->gen);
+            break;
+
+        case LVAL_MOD:
+            x->mod = v->mod;
+            break;
+
+        case LVAL_MAP:
+        case LVAL_SET:
+            x->hamt = v->hamt ? lhamt_ref(v->hamt) : NULL;
+            x->count = v->count;
+            break;
+
         case LVAL_SEXPR:
         case LVAL_QEXPR:
+        case LVAL_RECUR:
             x->count = v->count;
             x->cell = malloc(sizeof(lval*) * x->count);
             for (int i = 0; i < x->count; i++)
@@ -209,10 +382,21 @@ lval* lval_copy(lval* v)
             break;
     }
 
+    LHEAP_COPIED(x);
     return x;
 }
 
 
+void lval_name(lval* v, char* name)
+{
+    if (v->type != LVAL_FUN || v->builtin || v->sym)
+        return;
+
+    v->sym = malloc(strlen(name) + 1);
+    strcpy(v->sym, name);
+}
+
+
 lval* lval_pop(lval* v, int i)
 {
     lval* x = v->cell[i];
@@ -312,19 +496,110 @@ lval* lval_call(lenv* e, lval* f, lval* a)
 
     if (f->formals->count == 0)
     {
-        f->env->par = e;
-        return builtin_eval(f->env, lval_add(lval_sexpr(), lval_copy(f->body)));
+        lctx* c = e->ctx;
+
+        if (c && c->max_depth > 0 && c->depth >= c->max_depth)
+            return lval_err("Maximum call depth of %i exceeded.", c->max_depth);
+
+        if (lctx_stack_low())
+            return lval_err("Maximum call depth exceeded. Out of stack.");
+
+        f->env->par = f->home ? f->home : e;
+        f->env->ctx = c;
+
+        /// A `recur` in the body of `f` cannot restart a
+        /// `loop` of its caller.
+        int loops = c ? c->loops : 0;
+
+        if (c)
+        {
+            c->depth++;
+            c->loops = 0;
+        }
+
+        if (c && c->prof)
+            lprof_enter(c->prof, f);
+
+        if (c && c->trace)
+            ltrace_enter(c->trace);
+
+        lval* r = builtin_eval(f->env, lval_add(lval_sexpr(), lval_copy(f->body)));
+
+        if (c && c->trace)
+            ltrace_leave(c->trace, f);
+
+        if (c && c->prof)
+            lprof_leave(c->prof);
+
+        if (c)
+        {
+            c->depth--;
+            c->loops = loops;
+        }
+
+        if (r->type == LVAL_RECUR)
+        {
+            lval_del(r);
+            return lval_err("Function 'recur' called outside of a 'loop'.");
+        }
+
+        return r;
     }
     else
         return lval_copy(f);
 }
 
 
+lval* lval_apply(lenv* e, lval* f, lval* a)
+{
+    if (f->type != LVAL_FUN)
+    {
+        lval_del(a);
+        return lval_err("Cannot call non-function. "
+                        "Got %s, Expected %s.",
+                        ltype_name(f->type), ltype_name(LVAL_FUN));
+    }
+
+    if (f->builtin)
+        return f->builtin(e, a);
+
+    lval* g = lval_copy(f);
+    lval* r = lval_call(e, g, a);
+    lval_del(g);
+    return r;
+}
+
+
+lval* lval_eval_ref(lenv* e, lval* v)
+{
+    if (v->type == LVAL_SYM)
+        return lenv_get(e, v);
+
+    if (v->type != LVAL_SEXPR)
+        return lval_copy(v);
+
+    lval* x = lval_sexpr();
+    x->count = v->count;
+    x->cell = malloc(sizeof(lval*) * x->count);
+
+    for (int i = 0; i < v->count; i++)
+        x->cell[i] = lval_eval_ref(e, v->cell[i]);
+
+    return lval_eval_cells(e, x);
+}
+
+
 lval* lval_eval_sexpr(lenv* e, lval* v)
 {
     for (int i = 0; i < v->count; i++)
         v->cell[i] = lval_eval(e, v->cell[i]);
 
+    return lval_eval_cells(e, v);
+}
+
+
+lval* lval_eval_cells(lenv* e, lval* v)
+{
     for (int i = 0; i < v->count; i++)
         if (v->cell[i]->type == LVAL_ERR)
             return lval_take(v, i);
@@ -365,6 +640,27 @@ lval* lval_join(lval* x, lval* y)
 }
 
 
+/// Compares an entry of one map or set against another.
+struct lval_eq_data
+{
+    lval* other;
+    int eq;
+};
+
+
+static void lval_eq_entry(lhent* x, void* data)
+{
+    struct lval_eq_data* d = data;
+
+    if (!d->eq)
+        return;
+
+    lhent* y = lhamt_find(d->other->hamt, x->key, x->hash);
+
+    d->eq = y && (!x->val || lval_eq(x->val, y->val));
+}
+
+
 int lval_eq(lval* x, lval* y)
 {
     if (x->type != y->type)
@@ -384,6 +680,31 @@ int lval_eq(lval* x, lval* y)
         case LVAL_STR:
             return (strcmp(x->str, y->str) == 0);
 
+        case LVAL_SEQ:
+            return (x->seq == y->seq);
+
+        case LVAL_FUT:
+            return (x->fut == y->fut);
+
+        case LVAL_ACTOR:
+            return (x->actor == y->actor);
+
+        case LVAL_GEN:
+            return (x->gen == y->gen);
+
+        case LVAL_MOD:
+            return (x->mod == y->mod);
+
+        case LVAL_ARR:
+            if (x->arr->count != y->arr->count)
+                return 0;
+
+            for (int i = 0; i < x->arr->count; ++i)
+                if (!lval_eq(x->arr->items[i], y->arr->items[i]))
+                    return 0;
+
+            return 1;
+
         case LVAL_FUN:
             if (x->builtin || x->builtin)
                 return (x->builtin == y->builtin);
@@ -391,8 +712,20 @@ int lval_eq(lval* x, lval* y)
                 return (lval_eq(x->formals, y->formals) 
                         && lval_eq(x->body, y->body));
 
+        case LVAL_MAP:
+        case LVAL_SET:
+        {
+            if (x->count != y->count)
+                return 0;
+
+            struct lval_eq_data d = { y, 1 };
+            lhamt_each(x->hamt, lval_eq_entry, &d);
+            return d.eq;
+        }
+
         case LVAL_QEXPR:
         case LVAL_SEXPR:
+        case LVAL_RECUR:
             if (x->count != y->count)
                 return 0;
             
@@ -409,13 +742,158 @@ int lval_eq(lval* x, lval* y)
 }
 
 
+static int lval_cmp_cells(lval** x, int xn, lval** y, int yn)
+{
+    for (int i = 0; i < xn && i < yn; i++)
+    {
+        int c = lval_cmp(x[i], y[i]);
+
+        if (c)
+            return c;
+    }
+
+    return (xn > yn) - (xn < yn);
+}
+
+
+int lval_cmp(lval* x, lval* y)
+{
+    if (x->type != y->type)
+        return (x->type > y->type) - (x->type < y->type);
+
+    switch (x->type)
+    {
+        case LVAL_NUM:
+            return (x->num > y->num) - (x->num < y->num);
+
+        case LVAL_ERR:
+            return strcmp(x->err, y->err);
+
+        case LVAL_SYM:
+            return strcmp(x->sym, y->sym);
+
+        case LVAL_STR:
+            return strcmp(x->str, y->str);
+
+        case LVAL_ARR:
+            return lval_cmp_cells(x->arr->items, x->arr->count, 
+                                  y->arr->items, y->arr->count);
+
+        case LVAL_QEXPR:
+        case LVAL_SEXPR:
+        case LVAL_RECUR:
+            return lval_cmp_cells(x->cell, x->count, y->cell, y->count);
+    }
+
+    if (lval_eq(x, y))
+        return 0;
+
+    unsigned long hx = lval_hash(x);
+    unsigned long hy = lval_hash(y);
+    return (hx > hy) - (hx < hy);
+}
+
+
+#define LVAL_HASH_BASIS 14695981039346656037UL
+#define LVAL_HASH_PRIME 1099511628211UL
+
+
+static unsigned long lval_hash_bytes(unsigned long h, const void* p, size_t n)
+{
+    const unsigned char* b = p;
+
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ b[i]) * LVAL_HASH_PRIME;
+
+    return h;
+}
+
+
+static void lval_hash_entry(lhent* x, void* data)
+{
+    unsigned long h = x->hash;
+
+    if (x->val)
+        h = h * 31 + lval_hash(x->val);
+
+    *(unsigned long*)data += h;
+}
+
+
+unsigned long lval_hash(lval* v)
+{
+    unsigned long h = lval_hash_bytes(LVAL_HASH_BASIS, &v->type, sizeof(int));
+
+    switch (v->type)
+    {
+        case LVAL_NUM:
+            return lval_hash_bytes(h, &v->num, sizeof(long));
+
+        case LVAL_ERR:
+            return lval_hash_bytes(h, v->err, strlen(v->err));
+
+        case LVAL_SYM:
+            return lval_hash_bytes(h, v->sym, strlen(v->sym));
+
+        case LVAL_STR:
+            return lval_hash_bytes(h, v->str, strlen(v->str));
+
+        case LVAL_FUN:
+            if (v->builtin)
+                return lval_hash_bytes(h, &v->builtin, sizeof(lbuiltin));
+
+            h = (h ^ lval_hash(v->formals)) * LVAL_HASH_PRIME;
+            return (h ^ lval_hash(v->body)) * LVAL_HASH_PRIME;
+
+        case LVAL_SEQ:
+            return lval_hash_bytes(h, &v->seq, sizeof(lseq*));
+
+        case LVAL_FUT:
+            return lval_hash_bytes(h, &v->fut, sizeof(lfut*));
+
+        case LVAL_ACTOR:
+            return lval_hash_bytes(h, &v->actor, sizeof(lactor*));
+
+        case LVAL_GEN:
+            return lval_hash_bytes(h, &v->gen, sizeof(lgen*));
+
+        case LVAL_MOD:
+            return lval_hash_bytes(h, &v->mod, sizeof(lmod*));
+
+        case LVAL_ARR:
+            for (int i = 0; i < v->arr->count; i++)
+                h = (h ^ lval_hash(v->arr->items[i])) * LVAL_HASH_PRIME;
+
+            return h;
+
+        case LVAL_MAP:
+        case LVAL_SET:
+        {
+            unsigned long sum = 0;
+            lhamt_each(v->hamt, lval_hash_entry, &sum);
+            return (h ^ sum) * LVAL_HASH_PRIME;
+        }
+
+        case LVAL_QEXPR:
+        case LVAL_SEXPR:
+        case LVAL_RECUR:
+            for (int i = 0; i < v->count; i++)
+                h = (h ^ lval_hash(v->cell[i])) * LVAL_HASH_PRIME;
+
+            return h;
+    }
+
+    return h;
+}
+
+
 ////////////////////
 /// Prelude Load ///
 ////////////////////
 
 lval* load_prelude(lenv* e)
 {
-    #define PRELUDE_PATH_SIZE 100
+    #define PRELUDE_PATH_SIZE 4096
 
     char prelude_path[PRELUDE_PATH_SIZE];
 
@@ -425,24 +903,18 @@ lval* load_prelude(lenv* e)
         char* envvar = "HOME";
     #endif  /// _WIN32
 
-    if (!getenv(envvar))
-    {
-        fprintf(stderr, "The environment variable %s was not found.\n", envvar);
-        exit(1);
-    }
+    char* home = getenv(envvar);
 
- 
-    if (snprintf(prelude_path, PRELUDE_PATH_SIZE, "%s/.lix/stdlib/prelude.lx", getenv(envvar)) >= PRELUDE_PATH_SIZE)
-    {
-        fprintf(stderr, "PRELUDE_PATH_SIZE of %d was too small. Aborting\n", PRELUDE_PATH_SIZE);
-        exit(1);
-    }    
-    
-    lval* prelude = lval_add(lval_sexpr(), lval_str(prelude_path));
-    lval* p = builtin_load(e, prelude);
+    if (home && snprintf(prelude_path, PRELUDE_PATH_SIZE, "%s/.lix/stdlib/prelude.lx", home) >= PRELUDE_PATH_SIZE)
+        return lval_err("PRELUDE_PATH_SIZE of %d was too small.", PRELUDE_PATH_SIZE);
+
+    lval* image = limage_restore(e, home ? prelude_path : NULL);
+
+    if (image)
+        return image;
 
-    if (p->type == LVAL_ERR)
-        lval_println(p);
+    if (!home)
+        return lval_err("The environment variable %s was not found.", envvar);
 
-    return p;
+    return llazy_load(e, prelude_path);
 }
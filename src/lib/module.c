@@ -0,0 +1,204 @@
+/// realpath is an XSI interface.
+#define _XOPEN_SOURCE 700
+
+#include <module.h>
+#include <builtins.h>
+#include <lenv.h>
+#include <lval.h>
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef PATH_MAX
+#define PATH_MAX 4096
+#endif
+
+
+///////////////////////////
+/// `lmod` Constructors ///
+///////////////////////////
+
+static char* lmod_realpath(char* path, char* real)
+{
+#ifdef _WIN32
+    return _fullpath(real, path, PATH_MAX);
+#else
+    return realpath(path, real);
+#endif  /// _WIN32
+}
+
+
+lmod* lmod_require(lenv* e, char* path, lval** err)
+{
+    char real[PATH_MAX];
+    lctx* c = e->ctx->owner;
+
+    if (lmod_realpath(path, real) == NULL)
+    {
+        *err = lval_err("Could not load module %s", path);
+        return NULL;
+    }
+
+    pthread_rwlock_wrlock(&c->lock);
+
+    lmod* m = c->modules;
+
+    while (m && strcmp(m->path, real) != 0)
+        m = m->next;
+
+    int fresh = m == NULL;
+
+    /// Registered before it is loaded so a cycle of
+    /// requires ends at the partly loaded module.
+    if (fresh)
+    {
+        m = malloc(sizeof(lmod));
+        m->path = strcpy(malloc(strlen(real) + 1), real);
+        m->env = lenv_child(c->env);
+        m->env->root = 1;
+        m->exports = NULL;
+        m->loading = 1;
+        m->shared = 0;
+        m->next = c->modules;
+        c->modules = m;
+    }
+    else if (m->loading)
+        m->shared = 1;
+
+    pthread_rwlock_unlock(&c->lock);
+
+    if (!fresh)
+        return m;
+
+    lval* r = builtin_load(m->env, lval_add(lval_sexpr(), lval_str(real)));
+
+    pthread_rwlock_wrlock(&c->lock);
+
+    m->loading = 0;
+    int failed = r->type == LVAL_ERR;
+
+    /// A module that failed to load is unlinked so it can
+    /// be required again. One already handed to a cycle of
+    /// requires is still in use, so is only renamed.
+    if (failed && !m->shared)
+    {
+        lmod** p = &c->modules;
+
+        while (*p != m)
+            p = &(*p)->next;
+
+        *p = m->next;
+    }
+    else if (failed)
+        m->path[0] = '\0';
+
+    pthread_rwlock_unlock(&c->lock);
+
+    if (!failed)
+    {
+        lval_del(r);
+        return m;
+    }
+
+    if (!m->shared)
+        lmod_del(m);
+
+    *err = r;
+    return NULL;
+}
+
+
+void lmod_del(lmod* m)
+{
+    lenv_del(m->env);
+
+    if (m->exports)
+        lval_del(m->exports);
+
+    free(m->path);
+    free(m);
+}
+
+
+void lmod_del_all(lctx* c)
+{
+    while (c->modules)
+    {
+        lmod* m = c->modules;
+        c->modules = m->next;
+        lmod_del(m);
+    }
+}
+
+
+//////////////////////
+/// `lmod` Methods ///
+//////////////////////
+
+lmod* lmod_of(lenv* e)
+{
+    if (e->ctx == NULL)
+        return NULL;
+
+    lctx* c = e->ctx->owner;
+    lmod* found = NULL;
+
+    pthread_rwlock_rdlock(&c->lock);
+
+    for (; e && !found; e = e->par)
+        if (e->root)
+            for (lmod* m = c->modules; m && !found; m = m->next)
+                if (m->env == e)
+                    found = m;
+
+    pthread_rwlock_unlock(&c->lock);
+    return found;
+}
+
+
+lval* lmod_get(lmod* m, char* name)
+{
+    int exported = m->exports == NULL;
+
+    for (int i = 0; m->exports && i < m->exports->count && !exported; i++)
+        exported = strcmp(m->exports->cell[i]->sym, name) == 0;
+
+    if (!exported)
+        return lval_err("Module %s does not export '%s'", m->path, name);
+
+    lval* k = lval_sym(name);
+    lval* v = lenv_local(m->env, k);
+    lval_del(k);
+
+    if (v == NULL)
+        return lval_err("Module %s has no definition of '%s'", m->path, name);
+
+    if (v->type == LVAL_FUN && !v->builtin && v->home == NULL)
+        v->home = m->env;
+
+    return v;
+}
+
+
+lval* lmod_resolve(lenv* e, char* sym)
+{
+    char* slash = strchr(sym, '/');
+
+    if (slash == NULL || slash == sym || slash[1] == '\0')
+        return NULL;
+
+    lval* k = lval_sym_n(sym, (int)(slash - sym));
+    lval* ns = lenv_get(e, k);
+    lval_del(k);
+
+    if (ns->type != LVAL_MOD)
+    {
+        lval_del(ns);
+        return NULL;
+    }
+
+    lval* v = lmod_get(ns->mod, slash + 1);
+    lval_del(ns);
+    return v;
+}
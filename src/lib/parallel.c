@@ -0,0 +1,149 @@
+#include <parallel.h>
+#include <ctx.h>
+#include <lenv.h>
+#include <lval.h>
+#include <pool.h>
+#include <utilities.h>
+
+#include <stdlib.h>
+
+
+/// A contiguous run of items evaluated by one task.
+typedef struct lpar_job
+{
+    lenv* e;
+    lval* f;
+    int op;
+
+    lval** items;
+    lval** results;
+    int start;
+    int end;
+} lpar_job;
+
+
+static void lpar_run(void* arg)
+{
+    lpar_job* job = arg;
+
+    lctx c;
+    lctx_fork(job->e->ctx, &c);
+
+    lenv* te = lenv_child(job->e);
+    te->ctx = &c;
+    te->root = 1;
+
+    if (job->op == LPAR_REDUCE)
+    {
+        lval* acc = lval_copy(job->items[job->start]);
+
+        for (int i = job->start + 1; i < job->end && acc->type != LVAL_ERR; i++)
+            acc = lval_apply(te, job->f, lval_add(lval_add(lval_sexpr(), acc), 
+                                                  lval_copy(job->items[i])));
+
+        job->results[0] = acc;
+    }
+    else
+        for (int i = job->start; i < job->end; i++)
+            job->results[i] = lval_apply(te, job->f, lval_add(lval_sexpr(), 
+                                                      lval_copy(job->items[i])));
+
+    lenv_del(te);
+}
+
+
+/// Returns the first error of the `n` results `results`
+/// and frees every result if there is one.
+static lval* lpar_error(lval** results, int n)
+{
+    int i = 0;
+
+    while (i < n && results[i]->type != LVAL_ERR)
+        i++;
+
+    if (i == n)
+        return NULL;
+
+    for (int j = 0; j < n; j++)
+        if (j != i)
+            lval_del(results[j]);
+
+    return results[i];
+}
+
+
+lval* lparallel(lenv* e, lval* f, lval* z, lval** items, int n, int op)
+{
+    lpool* pool = e->ctx ? lctx_pool(e->ctx) : NULL;
+    int workers = pool ? pool->workers + 1 : 1;
+    int chunk = (e->ctx && e->ctx->chunk > 0) ? e->ctx->chunk 
+              : (n + workers * 4 - 1) / (workers * 4);
+
+    if (chunk < 1)
+        chunk = 1;
+
+    int jobs = (n + chunk - 1) / chunk;
+    lpar_job* job = malloc(sizeof(lpar_job) * (jobs ? jobs : 1));
+    lval** results = malloc(sizeof(lval*) * ((op == LPAR_REDUCE ? jobs : n) + 1));
+    lpool_group g = { 0 };
+
+    for (int j = 0; j < jobs; j++)
+    {
+        lpar_job x = { e, f, op, items, 
+                       (op == LPAR_REDUCE) ? results + j : results,
+                       j * chunk, (j + 1) * chunk < n ? (j + 1) * chunk : n };
+        job[j] = x;
+
+        if (pool)
+            lpool_submit(pool, &g, lpar_run, NULL, &job[j]);
+        else
+            lpar_run(&job[j]);
+    }
+
+    if (pool)
+        lpool_wait(pool, &g);
+
+    free(job);
+
+    lval* x;
+
+    if (op == LPAR_REDUCE)
+    {
+        if ((x = lpar_error(results, jobs)) == NULL)
+        {
+            x = lval_copy(z);
+            int j = 0;
+
+            for (; j < jobs && x->type != LVAL_ERR; j++)
+                x = lval_apply(e, f, lval_add(lval_add(lval_sexpr(), x), results[j]));
+
+            /// The results left once a combine fails.
+            for (; j < jobs; j++)
+                lval_del(results[j]);
+        }
+    }
+    else if ((x = lpar_error(results, n)) == NULL)
+    {
+        x = lval_qexpr();
+
+        for (int i = 0; i < n; i++)
+            if (op == LPAR_MAP)
+                lval_add(x, lval_copy(results[i]));
+            else if (results[i]->type != LVAL_NUM)
+            {
+                lval_del(x);
+                x = lval_err("Function 'pfilter' predicate returned incorrect "
+                             "type. Got %s, Expected %s.",
+                             ltype_name(results[i]->type), ltype_name(LVAL_NUM));
+                break;
+            }
+            else if (results[i]->num)
+                lval_add(x, lval_copy(items[i]));
+
+        for (int i = 0; i < n; i++)
+            lval_del(results[i]);
+    }
+
+    free(results);
+    return x;
+}
@@ -1,12 +1,64 @@
 #include <parser.h>
 
 #include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 
+#define LCHAR_SPACE     1
+#define LCHAR_SYM       2
+#define LCHAR_DIGIT     4
+#define LCHAR_ESCAPE    8
+
+
+/// Character classes indexed by (unsigned) character.
+/// Digits are also symbol characters, so a number is
+/// lexed as a symbol span and then checked for numberness.
+static const unsigned char lchar_class[256] = {
+    [' '] = LCHAR_SPACE, ['\t'] = LCHAR_SPACE, ['\v'] = LCHAR_SPACE,
+    ['\r'] = LCHAR_SPACE, ['\n'] = LCHAR_SPACE,
+
+    ['0'] = LCHAR_SYM | LCHAR_DIGIT, ['1'] = LCHAR_SYM | LCHAR_DIGIT,
+    ['2'] = LCHAR_SYM | LCHAR_DIGIT, ['3'] = LCHAR_SYM | LCHAR_DIGIT,
+    ['4'] = LCHAR_SYM | LCHAR_DIGIT, ['5'] = LCHAR_SYM | LCHAR_DIGIT,
+    ['6'] = LCHAR_SYM | LCHAR_DIGIT, ['7'] = LCHAR_SYM | LCHAR_DIGIT,
+    ['8'] = LCHAR_SYM | LCHAR_DIGIT, ['9'] = LCHAR_SYM | LCHAR_DIGIT,
+
+    ['a'] = LCHAR_SYM | LCHAR_ESCAPE, ['b'] = LCHAR_SYM | LCHAR_ESCAPE,
+    ['c'] = LCHAR_SYM, ['d'] = LCHAR_SYM, ['e'] = LCHAR_SYM, ['f'] = LCHAR_SYM | LCHAR_ESCAPE,
+    ['g'] = LCHAR_SYM, ['h'] = LCHAR_SYM, ['i'] = LCHAR_SYM, ['j'] = LCHAR_SYM,
+    ['k'] = LCHAR_SYM, ['l'] = LCHAR_SYM, ['m'] = LCHAR_SYM,
+    ['n'] = LCHAR_SYM | LCHAR_ESCAPE, ['o'] = LCHAR_SYM, ['p'] = LCHAR_SYM,
+    ['q'] = LCHAR_SYM, ['r'] = LCHAR_SYM | LCHAR_ESCAPE, ['s'] = LCHAR_SYM,
+    ['t'] = LCHAR_SYM | LCHAR_ESCAPE, ['u'] = LCHAR_SYM,
+    ['v'] = LCHAR_SYM | LCHAR_ESCAPE, ['w'] = LCHAR_SYM, ['x'] = LCHAR_SYM,
+    ['y'] = LCHAR_SYM, ['z'] = LCHAR_SYM,
+
+    ['A'] = LCHAR_SYM, ['B'] = LCHAR_SYM, ['C'] = LCHAR_SYM, ['D'] = LCHAR_SYM,
+    ['E'] = LCHAR_SYM, ['F'] = LCHAR_SYM, ['G'] = LCHAR_SYM, ['H'] = LCHAR_SYM,
+    ['I'] = LCHAR_SYM, ['J'] = LCHAR_SYM, ['K'] = LCHAR_SYM, ['L'] = LCHAR_SYM,
+    ['M'] = LCHAR_SYM, ['N'] = LCHAR_SYM, ['O'] = LCHAR_SYM, ['P'] = LCHAR_SYM,
+    ['Q'] = LCHAR_SYM, ['R'] = LCHAR_SYM, ['S'] = LCHAR_SYM, ['T'] = LCHAR_SYM,
+    ['U'] = LCHAR_SYM, ['V'] = LCHAR_SYM, ['W'] = LCHAR_SYM, ['X'] = LCHAR_SYM,
+    ['Y'] = LCHAR_SYM, ['Z'] = LCHAR_SYM,
+
+    ['_'] = LCHAR_SYM, ['+'] = LCHAR_SYM, ['-'] = LCHAR_SYM, ['*'] = LCHAR_SYM,
+    ['/'] = LCHAR_SYM, ['='] = LCHAR_SYM, ['<'] = LCHAR_SYM, ['>'] = LCHAR_SYM,
+    ['!'] = LCHAR_SYM, ['&'] = LCHAR_SYM,
+    ['\\'] = LCHAR_SYM | LCHAR_ESCAPE,
+
+    ['\''] = LCHAR_ESCAPE, ['"'] = LCHAR_ESCAPE,
+};
+
+
+#define LCHAR_IS(c, class) (lchar_class[(unsigned char)(c)] & (class))
+
+
 lval* lval_read_expr(char* s, int* i, char end)
 {
     lval* x = (end == '}') ? lval_qexpr() : lval_sexpr();
 
+    lval_read_skip(s, i);
+
     while (s[*i] != end)
     {
         lval* y = lval_read(s, i);
@@ -27,16 +79,65 @@ lval* lval_read_expr(char* s, int* i, char end)
 }
 
 
-lval* lval_read(char* s, int* i)
+void lval_read_skip(char* s, int* i)
 {
-    while (strchr(" \t\v\r\n;", s[*i]) && s[*i] != '\0')
+    for (;;)
     {
-        if (s[*i] == ';')
+        while (LCHAR_IS(s[*i], LCHAR_SPACE))
+            (*i)++;
+
+        if (s[*i] != ';')
+            return;
+
+        while (s[*i] != '\n' && s[*i] != '\0')
+            (*i)++;
+    }
+}
+
+
+void lval_read_scan(char* s, int* i)
+{
+    int depth = 0;
+
+    do
+    {
+        char c = s[*i];
+
+        if (c == '\0')
+            return;
+
+        if (c == '"')
+        {
+            for ((*i)++; s[*i] != '"' && s[*i] != '\0'; (*i)++)
+                if (s[*i] == '\\' && s[*i + 1] != '\0')
+                    (*i)++;
+
+            if (s[*i] == '"')
+                (*i)++;
+        }
+        else if (c == ';')
             while (s[*i] != '\n' && s[*i] != '\0')
                 (*i)++;
+        else if (LCHAR_IS(c, LCHAR_SYM))
+            while (LCHAR_IS(s[*i], LCHAR_SYM))
+                (*i)++;
+        else
+        {
+            if (c == '(' || c == '{')
+                depth++;
+            else if (c == ')' || c == '}')
+                depth--;
 
-        (*i)++;
+            (*i)++;
+        }
     }
+    while (depth > 0);
+}
+
+
+lval* lval_read(char* s, int* i)
+{
+    lval_read_skip(s, i);
 
     lval* x = NULL;
 
@@ -52,24 +153,14 @@ lval* lval_read(char* s, int* i)
         (*i)++;
         x = lval_read_expr(s, i, '}');
     }
-    else if (strchr(
-             "abcdefghijklmnopqrstuvwxyz"
-             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-             "0123456789_+-*\\/=<>!&", s[*i]))
+    else if (LCHAR_IS(s[*i], LCHAR_SYM))
         x = lval_read_sym(s, i);
-    else if (strchr("\"", s[*i]))
+    else if (s[*i] == '"')
         x = lval_read_str(s, i);
     else
         x = lval_err("Unexpected character %c", s[*i]);
 
-    while (strchr(" \t\v\r\n", s[*i]) && s[*i] != '\0')
-    {
-        if (s[*i] == ';')
-            while (s[*i] != '\n' && s[*i] != '\0')
-                (*i)++;
-
-        (*i)++;
-    }
+    lval_read_skip(s, i);
 
     return x;
 }
@@ -77,44 +168,41 @@ lval* lval_read(char* s, int* i)
 
 lval* lval_read_str(char*s , int* i)
 {
-    char* part = calloc(1, 1);
-
-    (*i)++;
+    int start = ++(*i);
+    int escaped = 0;
 
     while (s[*i] != '"')
     {
-        char c = s[*i];
-
-        if (c == '\0')
-        {
-            free(part);
+        if (s[*i] == '\0')
             return lval_err("Unexpected end of input");
-        }
 
-        if (c == '\\')
+        if (s[*i] == '\\')
         {
-            (*i)++;
+            if (!LCHAR_IS(s[*i + 1], LCHAR_ESCAPE))
+                return lval_err("Invalid escape sequence \\%c", s[*i + 1]);
 
-            if (strchr("abfnrtv\\\'\"", s[*i]))
-                c = lval_str_unescape(s[*i]);
-            else
-            {
-                free(part);
-                return lval_err("Invalid escape sequence \\%c", s[*i]);
-            }
+            escaped = 1;
+            (*i)++;
         }
 
-        part = realloc(part, strlen(part) + 2);
-        part[strlen(part) + 1] = '\0';
-        part[strlen(part) + 0] = c;
         (*i)++;
     }
 
+    lval* x = lval_str_n(s + start, *i - start);
+
     (*i)++;
 
-    lval* x = lval_str(part);
+    /// Escapes only ever shrink the string, so
+    /// they are resolved in place.
+    if (escaped)
+    {
+        char* p = x->str;
+
+        for (char* q = x->str; *q; q++)
+            *p++ = (*q == '\\') ? lval_str_unescape(*++q) : *q;
 
-    free(part);
+        *p = '\0';
+    }
 
     return x;
 }
@@ -122,44 +210,33 @@ lval* lval_read_str(char*s , int* i)
 
 lval* lval_read_sym(char* s, int* i)
 {
-    char* part = calloc(1, 1);
+    int start = *i;
 
-    while (strchr(
-           "abcdefghijklmnopqrstuvwxyz"
-           "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-           "0123456789_+-*\\/=<>!&", s[*i]) && s[*i] != '\0')
-    {
-        part = realloc(part, strlen(part) + 2);
-        part[strlen(part) + 1] = '\0';
-        part[strlen(part) + 0] = s[*i];
+    while (LCHAR_IS(s[*i], LCHAR_SYM))
         (*i)++;
-    }
 
-    int is_num = strchr("-0123456789", part[0]) != NULL;
+    char* part = s + start;
+    int len = *i - start;
 
-    for (int j = 1; j < strlen(part); j++)
-        if (strchr("0123456789", part[j]) == NULL)
-        {
-            is_num = 0;
-            break;
-        }
+    int is_num = LCHAR_IS(part[0], LCHAR_DIGIT) || (part[0] == '-' && len > 1);
 
-    if (strlen(part) == 1 && part[0] == '-')
-        is_num = 0;
+    for (int j = 1; is_num && j < len; j++)
+        is_num = LCHAR_IS(part[j], LCHAR_DIGIT);
 
-    lval* x = NULL;
+    if (!is_num)
+        return lval_sym_n(part, len);
 
-    if (is_num)
-    {
-        errno = 0;
-        long v = strtol(part, NULL, 10);
-        x = (errno != ERANGE) ? lval_num(v) : lval_err("Invalid Number %s", part);
-    }
-    else
-        x = lval_sym(part);
+    /// The span ends on a non-digit, so `strtol`
+    /// stops exactly at the end of the token.
+    errno = 0;
+    long v = strtol(part, NULL, 10);
 
-    free(part);
+    if (errno != ERANGE)
+        return lval_num(v);
 
+    lval* sym = lval_sym_n(part, len);
+    lval* x = lval_err("Invalid Number %s", sym->sym);
+    lval_del(sym);
     return x;
 }
 
@@ -0,0 +1,284 @@
+#include <pool.h>
+
+#include <stdlib.h>
+
+#define LPOOL_DEQUE_CAP 64
+
+
+/// The pool the calling thread works for (if any) and
+/// the index of its deque.
+static _Thread_local lpool* lpool_self = NULL;
+static _Thread_local int lpool_index = 0;
+
+
+/////////////////////////////
+/// `lpool_deque` Methods ///
+/////////////////////////////
+
+static void lpool_deque_init(lpool_deque* d)
+{
+    pthread_mutex_init(&d->lock, NULL);
+    d->items = malloc(sizeof(lpool_task*) * LPOOL_DEQUE_CAP);
+    d->cap = LPOOL_DEQUE_CAP;
+    d->head = 0;
+    d->tail = 0;
+}
+
+
+static void lpool_deque_push(lpool_deque* d, lpool_task* t)
+{
+    pthread_mutex_lock(&d->lock);
+
+    if (d->tail - d->head == d->cap)
+    {
+        lpool_task** items = malloc(sizeof(lpool_task*) * d->cap * 2);
+
+        for (int i = d->head; i < d->tail; i++)
+            items[i & (d->cap * 2 - 1)] = d->items[i & (d->cap - 1)];
+
+        free(d->items);
+        d->items = items;
+        d->cap *= 2;
+    }
+
+    d->items[d->tail++ & (d->cap - 1)] = t;
+    pthread_mutex_unlock(&d->lock);
+}
+
+
+/// Takes the newest task if `own` or else the oldest.
+static void lpool_deque_del(lpool_deque* d)
+{
+    pthread_mutex_destroy(&d->lock);
+    free(d->items);
+}
+
+
+static lpool_task* lpool_deque_take(lpool_deque* d, int own)
+{
+    lpool_task* t = NULL;
+
+    pthread_mutex_lock(&d->lock);
+
+    if (d->tail > d->head)
+        t = own ? d->items[--d->tail & (d->cap - 1)] 
+                : d->items[d->head++ & (d->cap - 1)];
+
+    pthread_mutex_unlock(&d->lock);
+    return t;
+}
+
+
+//////////////////////////
+/// `lpool` Scheduling ///
+//////////////////////////
+
+/// Takes a task from the deque at `self` or else steals
+/// one from the other deques.
+static lpool_task* lpool_take(lpool* p, int self)
+{
+    int n = p->size;
+    lpool_task* t = lpool_deque_take(&p->deques[self], 1);
+
+    for (int i = 1; t == NULL && i < n; i++)
+        t = lpool_deque_take(&p->deques[(self + i) % n], 0);
+
+    if (t)
+        p->queued--;
+
+    return t;
+}
+
+
+/// Wakes every thread sleeping on the pool.
+static void lpool_notify(lpool* p)
+{
+    pthread_mutex_lock(&p->lock);
+    pthread_cond_broadcast(&p->ready);
+    pthread_mutex_unlock(&p->lock);
+}
+
+
+static void lpool_run(lpool* p, lpool_task* t)
+{
+    t->run(t->arg);
+
+    int last = (--t->group->pending == 0);
+    last |= (--p->all.pending == 0);
+
+    if (last)
+        lpool_notify(p);
+
+    if (t->release)
+        t->release(t->arg);
+
+    free(t);
+}
+
+
+/// Returns the deque the calling thread uses for `p`.
+static int lpool_home(lpool* p)
+{
+    return (lpool_self == p) ? lpool_index : p->size - 1;
+}
+
+
+/// Binds a new worker to a deque of a pool.
+struct lpool_start
+{
+    lpool* p;
+    int index;
+};
+
+
+static void* lpool_worker(void* arg)
+{
+    struct lpool_start* s = arg;
+    lpool* p = s->p;
+
+    lpool_self = p;
+    lpool_index = s->index;
+    free(s);
+
+    while (1)
+    {
+        lpool_task* t = lpool_take(p, lpool_index);
+
+        if (t)
+        {
+            lpool_run(p, t);
+            continue;
+        }
+
+        pthread_mutex_lock(&p->lock);
+
+        while (!p->stop && p->queued == 0)
+            pthread_cond_wait(&p->ready, &p->lock);
+
+        int stop = p->stop && p->queued == 0;
+        pthread_mutex_unlock(&p->lock);
+
+        if (stop)
+            break;
+    }
+
+    return NULL;
+}
+
+
+////////////////////////////
+/// `lpool` Constructors ///
+////////////////////////////
+
+lpool* lpool_new(int workers)
+{
+    lpool* p = malloc(sizeof(lpool));
+    p->workers = 0;
+    p->threads = malloc(sizeof(pthread_t) * workers);
+    p->size = workers + 1;
+    p->deques = malloc(sizeof(lpool_deque) * p->size);
+
+    for (int i = 0; i < p->size; i++)
+        lpool_deque_init(&p->deques[i]);
+
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->ready, NULL);
+
+    p->all.pending = 0;
+    p->queued = 0;
+    p->stop = 0;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, LPOOL_STACK_SIZE);
+
+    for (int i = 0; i < workers; i++)
+    {
+        struct lpool_start* s = malloc(sizeof(struct lpool_start));
+        s->p = p;
+        s->index = i;
+
+        if (pthread_create(&p->threads[i], &attr, lpool_worker, s) != 0)
+        {
+            free(s);
+            break;
+        }
+
+        p->workers++;
+    }
+
+    pthread_attr_destroy(&attr);
+    return p;
+}
+
+
+///////////////////////////
+/// `lpool` Destructors ///
+///////////////////////////
+
+void lpool_del(lpool* p)
+{
+    pthread_mutex_lock(&p->lock);
+    p->stop = 1;
+    pthread_cond_broadcast(&p->ready);
+    pthread_mutex_unlock(&p->lock);
+
+    for (int i = 0; i < p->workers; i++)
+        pthread_join(p->threads[i], NULL);
+
+    for (int i = 0; i < p->size; i++)
+        lpool_deque_del(&p->deques[i]);
+
+    pthread_mutex_destroy(&p->lock);
+    pthread_cond_destroy(&p->ready);
+
+    free(p->deques);
+    free(p->threads);
+    free(p);
+}
+
+
+///////////////////////
+/// `lpool` Methods ///
+///////////////////////
+
+void lpool_submit(lpool* p, lpool_group* g, void (*run)(void*), 
+                  void (*release)(void*), void* arg)
+{
+    lpool_task* t = malloc(sizeof(lpool_task));
+    t->run = run;
+    t->release = release;
+    t->arg = arg;
+    t->group = g;
+
+    g->pending++;
+    p->all.pending++;
+
+    lpool_deque_push(&p->deques[lpool_home(p)], t);
+    p->queued++;
+    lpool_notify(p);
+}
+
+
+void lpool_wait(lpool* p, lpool_group* g)
+{
+    int self = lpool_home(p);
+
+    while (g->pending > 0)
+    {
+        lpool_task* t = lpool_take(p, self);
+
+        if (t)
+        {
+            lpool_run(p, t);
+            continue;
+        }
+
+        pthread_mutex_lock(&p->lock);
+
+        while (g->pending > 0 && p->queued == 0)
+            pthread_cond_wait(&p->ready, &p->lock);
+
+        pthread_mutex_unlock(&p->lock);
+    }
+}
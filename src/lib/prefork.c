@@ -0,0 +1,751 @@
+/// fork, poll and friends are POSIX interfaces.
+#define _XOPEN_SOURCE 700
+
+#include <prefork.h>
+#include <ctx.h>
+#include <io.h>
+#include <lazy.h>
+#include <lval.h>
+#include <serve.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define LPREFORK_READ_SIZE (64 * 1024)
+
+
+/// Bytes read but not consumed yet, or waiting to be
+/// written.
+typedef struct lbytes
+{
+    char* data;
+    long len;
+    long cap;
+} lbytes;
+
+
+struct lclient;
+
+
+/// A worker process and the pipes to it. `client` is
+/// the connection whose request it is running, if busy.
+typedef struct lworker
+{
+    pid_t pid;
+    int to;
+    int from;
+    int served;
+
+    struct lclient* client;
+    lbytes reply;
+} lworker;
+
+
+/// A connection (or stdin and stdout) and its one
+/// request in flight. `req` holds a request read but not
+/// dispatched yet; `waiting` is set while a worker runs it.
+typedef struct lclient
+{
+    int in;
+    int out;
+    int eof;
+
+    lbytes input;
+    char* req;
+    long req_len;
+    int waiting;
+
+    lbytes output;
+    long sent;
+
+    struct lclient* next;
+} lclient;
+
+
+typedef struct lprefork
+{
+    lctx* c;
+    int listen;
+
+    lworker* workers;
+    int count;
+
+    lclient* clients;
+
+    int max_requests;
+    long max_rss;
+} lprefork;
+
+
+///////////////
+/// Buffers ///
+///////////////
+
+static void lbytes_add(lbytes* b, const char* s, long n)
+{
+    if (b->len + n > b->cap)
+    {
+        while (b->len + n > b->cap)
+            b->cap = b->cap ? b->cap * 2 : 256;
+
+        b->data = realloc(b->data, b->cap);
+    }
+
+    memcpy(b->data + b->len, s, n);
+    b->len += n;
+}
+
+
+static void lbytes_drop(lbytes* b, long n)
+{
+    if (n == 0)
+        return;
+
+    memmove(b->data, b->data + n, b->len - n);
+    b->len -= n;
+}
+
+
+/// Reads whatever is available on `fd` into `b`. Returns
+/// 0 once `fd` ends or fails.
+static int lbytes_read(lbytes* b, int fd)
+{
+    char chunk[LPREFORK_READ_SIZE];
+    long n;
+
+    do
+        n = read(fd, chunk, sizeof(chunk));
+    while (n < 0 && errno == EINTR);
+
+    if (n > 0)
+        lbytes_add(b, chunk, n);
+
+    return n > 0 || (n < 0 && errno == EAGAIN);
+}
+
+
+/// Writes all of `s` to the blocking descriptor `fd`,
+/// failing rather than raising SIGPIPE if it is closed.
+static int lprefork_send(int fd, const char* s, long n)
+{
+    for (long done = 0; done < n; )
+    {
+        long k = lserve_send(fd, s + done, n - done);
+
+        if (k < 0 && errno == EINTR)
+            continue;
+
+        if (k <= 0)
+            return 0;
+
+        done += k;
+    }
+
+    return 1;
+}
+
+
+///////////////
+/// Workers ///
+///////////////
+
+/// Returns the resident size of the process `pid` in
+/// kilobytes, or 0 if it cannot be told.
+static long lprefork_rss(pid_t pid)
+{
+    long pages = 0;
+
+    #ifdef __linux__
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/%d/statm", (int)pid);
+
+        FILE* f = fopen(path, "r");
+        long size;
+
+        if (f == NULL)
+            return 0;
+
+        if (fscanf(f, "%ld %ld", &size, &pages) != 2)
+            pages = 0;
+
+        fclose(f);
+    #endif  /// __linux__
+
+    return pages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+
+/// Runs in a new worker: closes everything belonging to
+/// the supervisor and serves requests from its pipe until
+/// the supervisor closes it.
+static void lprefork_work(lprefork* p, lworker* w, int in, int out)
+{
+    if (p->listen >= 0)
+        close(p->listen);
+
+    for (lclient* cl = p->clients; cl; cl = cl->next)
+    {
+        close(cl->in);
+
+        if (cl->out != cl->in)
+            close(cl->out);
+    }
+
+    for (int i = 0; i < p->count; i++)
+        if (&p->workers[i] != w && p->workers[i].pid > 0)
+        {
+            close(p->workers[i].to);
+            close(p->workers[i].from);
+        }
+
+    /// Threads do not survive a fork, so a worker starts
+    /// its own pool and event loop if it needs them.
+    p->c->pool = NULL;
+    p->c->loop = NULL;
+
+    lval* x = lserve_stream(p->c, fdopen(in, "rb"), fdopen(out, "wb"));
+
+    if (x->type == LVAL_ERR)
+        lval_fprintln(stderr, x);
+
+    _exit(0);
+}
+
+
+static int lprefork_spawn(lprefork* p, lworker* w)
+{
+    int req[2];
+    int resp[2];
+
+    w->pid = -1;
+    w->client = NULL;
+    w->served = 0;
+    w->reply.len = 0;
+
+    if (pipe(req) != 0)
+        return 0;
+
+    if (pipe(resp) != 0)
+    {
+        close(req[0]);
+        close(req[1]);
+        return 0;
+    }
+
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        close(req[1]);
+        close(resp[0]);
+        lprefork_work(p, w, req[0], resp[1]);
+    }
+
+    close(req[0]);
+    close(resp[1]);
+
+    if (pid < 0)
+    {
+        close(req[1]);
+        close(resp[0]);
+        return 0;
+    }
+
+    w->pid = pid;
+    w->to = req[1];
+    w->from = resp[0];
+    return 1;
+}
+
+
+/// Stops the worker `w`, which exits once it reads
+/// the end of its requests.
+static void lprefork_retire(lworker* w)
+{
+    if (w->pid <= 0)
+        return;
+
+    close(w->to);
+    close(w->from);
+    waitpid(w->pid, NULL, 0);
+    w->pid = -1;
+}
+
+
+///////////////
+/// Clients ///
+///////////////
+
+static lclient* lprefork_client(lprefork* p, int in, int out)
+{
+    lclient* cl = calloc(1, sizeof(lclient));
+    cl->in = in;
+    cl->out = out;
+    cl->next = p->clients;
+    p->clients = cl;
+    return cl;
+}
+
+
+static void lprefork_reply(lclient* cl, int ok, char* msg)
+{
+    char head[64];
+    long n = strlen(msg);
+    int k = snprintf(head, sizeof(head), "%s %ld 0\n", ok ? "ok" : "err", n + 1);
+
+    lbytes_add(&cl->output, head, k);
+    lbytes_add(&cl->output, msg, n);
+    lbytes_add(&cl->output, "\n", 1);
+}
+
+
+/// Takes the next complete request off the input of
+/// `cl`, framed as lserve_stream expects. Returns 1 on a
+/// request, 0 if it is not all there yet and -1 if it
+/// is malformed.
+static int lprefork_parse(lclient* cl)
+{
+    lbytes* b = &cl->input;
+    long i = 0;
+
+    while (i < b->len && (b->data[i] == '\n' || b->data[i] == '\r'))
+        i++;
+
+    lbytes_drop(b, i);
+
+    char* nl = b->len ? memchr(b->data, '\n', b->len) : NULL;
+
+    if (nl == NULL)
+        return (b->len > LSERVE_MAX_REQUEST) ? -1 : 0;
+
+    long line = nl - b->data;
+    long start = 0;
+    long len = line;
+
+    if (b->data[0] == '#')
+    {
+        char* end;
+        len = strtol(b->data + 1, &end, 10);
+
+        if (end == b->data + 1 || (end != nl && !(*end == '\r' && end + 1 == nl)))
+            return -1;
+
+        if (len < 0 || len > LSERVE_MAX_REQUEST)
+            return -1;
+
+        if (b->len < line + 1 + len)
+            return 0;
+
+        start = line + 1;
+    }
+    else if (len > 0 && b->data[len - 1] == '\r')
+        len--;
+
+    cl->req = malloc(len ? len : 1);
+    cl->req_len = len;
+    memcpy(cl->req, b->data + start, len);
+
+    lbytes_drop(b, (start ? start + len : line + 1));
+    return 1;
+}
+
+
+/// Closes `cl` once nothing is left to read, run or
+/// write for it.
+static int lprefork_done(lprefork* p, lclient* cl)
+{
+    if (!cl->eof || cl->req || cl->waiting || cl->sent < cl->output.len)
+        return 0;
+
+    if (p->listen >= 0)
+        close(cl->in);
+
+    free(cl->input.data);
+    free(cl->output.data);
+    free(cl);
+    return 1;
+}
+
+
+/// Forgets everything `cl` has yet to read or be sent,
+/// after it hung up.
+static void lprefork_drop(lclient* cl)
+{
+    cl->eof = 1;
+    cl->input.len = 0;
+    cl->output.len = 0;
+    cl->sent = 0;
+
+    free(cl->req);
+    cl->req = NULL;
+}
+
+
+////////////////
+/// Dispatch ///
+////////////////
+
+static void lprefork_dispatch(lprefork* p)
+{
+    for (lclient* cl = p->clients; cl; cl = cl->next)
+    {
+        if (cl->req == NULL || cl->waiting)
+            continue;
+
+        lworker* w = NULL;
+        int alive = 0;
+
+        for (int i = 0; i < p->count && w == NULL; i++)
+        {
+            alive |= p->workers[i].pid > 0;
+
+            if (p->workers[i].pid > 0 && p->workers[i].client == NULL)
+                w = &p->workers[i];
+        }
+
+        /// Workers that could not be replaced are tried
+        /// again when one is needed.
+        for (int i = 0; i < p->count && w == NULL; i++)
+            if (p->workers[i].pid <= 0 && lprefork_spawn(p, &p->workers[i]))
+                w = &p->workers[i];
+
+        if (w == NULL && !alive)
+        {
+            lprefork_reply(cl, 0, "Error: No worker could be started.");
+            free(cl->req);
+            cl->req = NULL;
+            continue;
+        }
+
+        if (w == NULL)
+            return;
+
+        char head[32];
+        int k = snprintf(head, sizeof(head), "#%ld\n", cl->req_len);
+
+        if (!lprefork_send(w->to, head, k) || !lprefork_send(w->to, cl->req, cl->req_len))
+        {
+            lprefork_retire(w);
+            lprefork_spawn(p, w);
+
+            /// Tried again on the next round.
+            continue;
+        }
+
+        free(cl->req);
+        cl->req = NULL;
+        cl->waiting = 1;
+        w->client = cl;
+    }
+}
+
+
+/// Reads from the worker `w`, passing its response on
+/// to the client once complete.
+static void lprefork_collect(lprefork* p, lworker* w)
+{
+    if (!lbytes_read(&w->reply, w->from))
+    {
+        if (w->client)
+        {
+            w->client->waiting = 0;
+            lprefork_reply(w->client, 0, "Error: Worker exited while evaluating the request.");
+        }
+
+        lprefork_retire(w);
+        lprefork_spawn(p, w);
+        return;
+    }
+
+    char* nl = memchr(w->reply.data, '\n', w->reply.len);
+
+    if (nl == NULL)
+        return;
+
+    char* size = memchr(w->reply.data, ' ', nl - w->reply.data);
+    long len = size ? strtol(size + 1, NULL, 10) : 0;
+    long total = (nl - w->reply.data) + 1 + len;
+
+    if (w->reply.len < total)
+        return;
+
+    lclient* cl = w->client;
+
+    if (cl)
+        lbytes_add(&cl->output, w->reply.data, total);
+
+    lbytes_drop(&w->reply, total);
+
+    if (cl)
+        cl->waiting = 0;
+
+    w->client = NULL;
+    w->served++;
+
+    if ((p->max_requests > 0 && w->served >= p->max_requests)
+        || (p->max_rss > 0 && lprefork_rss(w->pid) > p->max_rss))
+    {
+        lprefork_retire(w);
+        lprefork_spawn(p, w);
+    }
+}
+
+
+static void lprefork_take(lclient* cl)
+{
+    if (!lbytes_read(&cl->input, cl->in))
+        cl->eof = 1;
+}
+
+
+/// Takes the next request of `cl` off its input once
+/// the last one is answered. Requests already read are
+/// still answered after the client stops sending.
+static void lprefork_next(lclient* cl)
+{
+    if (cl->req || cl->waiting || lprefork_parse(cl) >= 0)
+        return;
+
+    lprefork_reply(cl, 0, "Error: Malformed request header.");
+    cl->eof = 1;
+    cl->input.len = 0;
+}
+
+
+static void lprefork_flush(lclient* cl)
+{
+    long n = lserve_send(cl->out, cl->output.data + cl->sent, cl->output.len - cl->sent);
+
+    if (n < 0 && (errno == EAGAIN || errno == EINTR))
+        return;
+
+    if (n <= 0)
+    {
+        lprefork_drop(cl);
+        return;
+    }
+
+    cl->sent += n;
+
+    if (cl->sent == cl->output.len)
+    {
+        cl->output.len = 0;
+        cl->sent = 0;
+    }
+}
+
+
+//////////////////////////////
+/// Pre-Forked Worker Pool ///
+//////////////////////////////
+
+static int lprefork_listen(char* path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return -1;
+
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return -1;
+
+    unlink(path);
+
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+
+static void lprefork_loop(lprefork* p)
+{
+    enum { LISTEN, IN, OUT, WORKER };
+
+    for (;;)
+    {
+        for (lclient** cl = &p->clients; *cl; )
+        {
+            lprefork_next(*cl);
+
+            lclient* next = (*cl)->next;
+
+            if (lprefork_done(p, *cl))
+                *cl = next;
+            else
+                cl = &(*cl)->next;
+        }
+
+        if (p->listen < 0 && p->clients == NULL)
+            return;
+
+        lprefork_dispatch(p);
+
+        int n = 1 + p->count;
+
+        for (lclient* cl = p->clients; cl; cl = cl->next)
+            n += 2;
+
+        struct pollfd* fds = calloc(n, sizeof(struct pollfd));
+        void** who = calloc(n, sizeof(void*));
+        int* kind = calloc(n, sizeof(int));
+        int k = 0;
+
+        if (p->listen >= 0)
+        {
+            fds[k] = (struct pollfd){ p->listen, POLLIN, 0 };
+            kind[k++] = LISTEN;
+        }
+
+        for (lclient* cl = p->clients; cl; cl = cl->next)
+        {
+            if (!cl->eof && cl->req == NULL && !cl->waiting)
+            {
+                fds[k] = (struct pollfd){ cl->in, POLLIN, 0 };
+                who[k] = cl;
+                kind[k++] = IN;
+            }
+
+            if (cl->sent < cl->output.len)
+            {
+                fds[k] = (struct pollfd){ cl->out, POLLOUT, 0 };
+                who[k] = cl;
+                kind[k++] = OUT;
+            }
+        }
+
+        for (int i = 0; i < p->count; i++)
+            if (p->workers[i].pid > 0)
+            {
+                fds[k] = (struct pollfd){ p->workers[i].from, POLLIN, 0 };
+                who[k] = &p->workers[i];
+                kind[k++] = WORKER;
+            }
+
+        if (poll(fds, k, -1) < 0 && errno != EINTR)
+            k = -1;
+
+        for (int i = 0; i < k; i++)
+        {
+            if (fds[i].revents == 0)
+                continue;
+
+            if (kind[i] == LISTEN)
+            {
+                int conn = accept(p->listen, NULL, NULL);
+
+                if (conn >= 0)
+                {
+                    fcntl(conn, F_SETFL, fcntl(conn, F_GETFL) | O_NONBLOCK);
+                    lprefork_client(p, conn, conn);
+                }
+            }
+            else if (kind[i] == IN)
+                lprefork_take(who[i]);
+            else if (kind[i] == OUT)
+                lprefork_flush(who[i]);
+            else
+                lprefork_collect(p, who[i]);
+        }
+
+        free(fds);
+        free(who);
+        free(kind);
+
+        if (k < 0)
+            return;
+    }
+}
+
+
+lval* lprefork_serve(lctx* c, char* socket, int workers, int max_requests, long max_rss)
+{
+    lprefork p;
+    p.c = c;
+    p.listen = -1;
+    p.clients = NULL;
+    p.count = workers;
+    p.workers = calloc(workers, sizeof(lworker));
+    p.max_requests = max_requests;
+    p.max_rss = max_rss;
+
+    if (socket && (p.listen = lprefork_listen(socket)) < 0)
+    {
+        free(p.workers);
+        return lval_err("Could not listen on %s: %s", socket, strerror(errno));
+    }
+
+    if (socket == NULL)
+        lprefork_client(&p, STDIN_FILENO, STDOUT_FILENO);
+
+    /// Definitions still unbound would be bound again by
+    /// every worker, into pages of its own.
+    llazy* l = c->owner->lazy;
+
+    for (int i = 0; l && i < l->count; i++)
+        llazy_resolve(c->env, l->syms[i]);
+
+    int started = 0;
+
+    for (int i = 0; i < workers; i++)
+        started += lprefork_spawn(&p, &p.workers[i]);
+
+    lval* r = started ? lval_sexpr() : lval_err("Could not fork any workers: %s", strerror(errno));
+
+    if (started)
+        lprefork_loop(&p);
+
+    for (int i = 0; i < workers; i++)
+    {
+        lprefork_retire(&p.workers[i]);
+        free(p.workers[i].reply.data);
+    }
+
+    while (p.clients)
+    {
+        lclient* next = p.clients->next;
+        free(p.clients->input.data);
+        free(p.clients->output.data);
+        free(p.clients->req);
+        free(p.clients);
+        p.clients = next;
+    }
+
+    if (p.listen >= 0)
+        close(p.listen);
+
+    free(p.workers);
+    return r;
+}
+
+
+#else
+
+
+lval* lprefork_serve(lctx* c, char* socket, int workers, int max_requests, long max_rss)
+{
+    return lval_err("Pre-forked workers are not supported on this platform.");
+}
+
+
+#endif  /// _WIN32
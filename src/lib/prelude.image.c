@@ -0,0 +1,614 @@
+/// Generated from ./stdlib/prelude.lx by create-image.sh. Do not edit.
+
+#include <image.h>
+
+
+const unsigned char limage_prelude[] = {
+    0x7b, 0x04, 0x53, 0x04, 0x4c, 0x49, 0x58, 0x49, 0x4e, 0x02, 0x53, 0x05,
+    0x30, 0x2e, 0x33, 0x2e, 0x31, 0x53, 0xd6, 0x1f, 0x3b, 0x20, 0x41, 0x74,
+    0x6f, 0x6d, 0x73, 0x0a, 0x28, 0x64, 0x65, 0x66, 0x20, 0x7b, 0x4e, 0x69,
+    0x6c, 0x7d, 0x20, 0x7b, 0x7d, 0x29, 0x0a, 0x28, 0x64, 0x65, 0x66, 0x20,
+    0x7b, 0x54, 0x72, 0x75, 0x65, 0x7d, 0x20, 0x31, 0x29, 0x0a, 0x28, 0x64,
+    0x65, 0x66, 0x20, 0x7b, 0x46, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x20, 0x30,
+    0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+    0x73, 0x0a, 0x28, 0x64, 0x65, 0x66, 0x20, 0x7b, 0x66, 0x75, 0x6e, 0x7d,
+    0x20, 0x28, 0x5c, 0x20, 0x7b, 0x66, 0x20, 0x61, 0x7d, 0x20, 0x7b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x28, 0x68, 0x65, 0x61,
+    0x64, 0x20, 0x66, 0x29, 0x20, 0x28, 0x5c, 0x20, 0x28, 0x74, 0x61, 0x69,
+    0x6c, 0x20, 0x66, 0x29, 0x20, 0x61, 0x29, 0x0a, 0x7d, 0x29, 0x29, 0x0a,
+    0x0a, 0x3b, 0x20, 0x55, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x4c, 0x69,
+    0x73, 0x74, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b,
+    0x20, 0x66, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x65, 0x76, 0x61, 0x6c, 0x20, 0x28, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28,
+    0x6c, 0x69, 0x73, 0x74, 0x20, 0x66, 0x29, 0x20, 0x6c, 0x29, 0x0a, 0x7d,
+    0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x50, 0x61, 0x63, 0x6b, 0x20, 0x4c, 0x69,
+    0x73, 0x74, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x66,
+    0x20, 0x26, 0x20, 0x78, 0x73, 0x7d, 0x20, 0x7b, 0x66, 0x20, 0x78, 0x73,
+    0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x43, 0x75, 0x72, 0x72, 0x69, 0x65,
+    0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x55, 0x6e, 0x63, 0x75, 0x72, 0x72,
+    0x69, 0x65, 0x64, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x0a,
+    0x28, 0x64, 0x65, 0x66, 0x20, 0x7b, 0x63, 0x75, 0x72, 0x72, 0x79, 0x7d,
+    0x20, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x29, 0x0a, 0x28, 0x64, 0x65,
+    0x66, 0x20, 0x7b, 0x75, 0x6e, 0x63, 0x75, 0x72, 0x72, 0x79, 0x7d, 0x20,
+    0x70, 0x61, 0x63, 0x6b, 0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x4f, 0x70, 0x65,
+    0x6e, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x73, 0x63, 0x6f, 0x70, 0x65, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x61, 0x7d,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x5c, 0x20, 0x7b,
+    0x5f, 0x7d, 0x20, 0x61, 0x29, 0x20, 0x28, 0x29, 0x29, 0x0a, 0x7d, 0x29,
+    0x0a, 0x0a, 0x3b, 0x20, 0x69, 0x73, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20,
+    0x7b, 0x69, 0x73, 0x20, 0x78, 0x20, 0x79, 0x7d, 0x20, 0x7b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x78, 0x20,
+    0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x54, 0x72, 0x75, 0x65, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7b, 0x46, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x0a, 0x7d, 0x29,
+    0x0a, 0x0a, 0x3b, 0x20, 0x4c, 0x6f, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x20,
+    0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x28, 0x66,
+    0x75, 0x6e, 0x20, 0x7b, 0x6e, 0x6f, 0x74, 0x20, 0x78, 0x7d, 0x20, 0x7b,
+    0x2d, 0x20, 0x31, 0x20, 0x78, 0x7d, 0x29, 0x0a, 0x28, 0x66, 0x75, 0x6e,
+    0x20, 0x7b, 0x6f, 0x72, 0x20, 0x78, 0x20, 0x79, 0x7d, 0x20, 0x7b, 0x2b,
+    0x20, 0x78, 0x20, 0x79, 0x7d, 0x29, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20,
+    0x7b, 0x61, 0x6e, 0x64, 0x20, 0x78, 0x20, 0x79, 0x7d, 0x20, 0x7b, 0x2a,
+    0x20, 0x78, 0x20, 0x79, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x55, 0x74,
+    0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x73, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x66, 0x6c,
+    0x69, 0x70, 0x20, 0x66, 0x20, 0x61, 0x20, 0x62, 0x7d, 0x20, 0x7b, 0x66,
+    0x20, 0x62, 0x20, 0x61, 0x7d, 0x29, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20,
+    0x7b, 0x67, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x26, 0x20, 0x78, 0x73, 0x7d,
+    0x20, 0x7b, 0x65, 0x76, 0x61, 0x6c, 0x20, 0x78, 0x73, 0x7d, 0x29, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73,
+    0x65, 0x20, 0x66, 0x20, 0x67, 0x20, 0x78, 0x7d, 0x20, 0x7b, 0x66, 0x20,
+    0x28, 0x67, 0x20, 0x78, 0x29, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x64,
+    0x6f, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x28, 0x66, 0x75, 0x6e,
+    0x20, 0x7b, 0x64, 0x6f, 0x20, 0x26, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x6c,
+    0x20, 0x4e, 0x69, 0x6c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7b, 0x4e, 0x69, 0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x6c, 0x7d,
+    0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20,
+    0x41, 0x6c, 0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x73, 0x0a, 0x0a,
+    0x3b, 0x3b, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74, 0x2c, 0x20, 0x53, 0x65,
+    0x63, 0x6f, 0x6e, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x68, 0x69,
+    0x72, 0x64, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x69, 0x6e, 0x20,
+    0x61, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20,
+    0x7b, 0x66, 0x73, 0x74, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x20, 0x65, 0x76,
+    0x61, 0x6c, 0x20, 0x28, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6c, 0x29, 0x20,
+    0x7d, 0x29, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x73, 0x6e, 0x64,
+    0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x20, 0x28,
+    0x68, 0x65, 0x61, 0x64, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c,
+    0x29, 0x29, 0x20, 0x7d, 0x29, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b,
+    0x74, 0x72, 0x64, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x20, 0x65, 0x76, 0x61,
+    0x6c, 0x20, 0x28, 0x68, 0x65, 0x61, 0x64, 0x20, 0x28, 0x74, 0x61, 0x69,
+    0x6c, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x29, 0x29,
+    0x20, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x4c, 0x65, 0x6e, 0x67,
+    0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x0a, 0x28,
+    0x66, 0x75, 0x6e, 0x20, 0x7b, 0x6c, 0x65, 0x6e, 0x20, 0x6c, 0x7d, 0x20,
+    0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d,
+    0x20, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x30, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x2b, 0x20, 0x31, 0x20, 0x28, 0x6c, 0x65,
+    0x6e, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x29, 0x7d,
+    0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x41, 0x6c, 0x6c, 0x20,
+    0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x0a, 0x28, 0x66,
+    0x75, 0x6e, 0x20, 0x7b, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x6c, 0x7d, 0x20,
+    0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d,
+    0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x20, 0x4e, 0x69,
+    0x6c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x4e, 0x69, 0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x7b, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28, 0x68, 0x65, 0x61, 0x64,
+    0x20, 0x6c, 0x29, 0x20, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x28, 0x74,
+    0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a,
+    0x0a, 0x3b, 0x3b, 0x20, 0x52, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x29,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x4e, 0x69,
+    0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x29, 0x20,
+    0x28, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6c, 0x29, 0x7d, 0x0a, 0x7d, 0x29,
+    0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x4e, 0x74, 0x68, 0x20, 0x49, 0x74, 0x65,
+    0x6d, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x6e, 0x74, 0x68, 0x20,
+    0x6e, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x6e, 0x20, 0x30, 0x29, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x66, 0x73, 0x74, 0x20,
+    0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x6e, 0x74, 0x68, 0x20, 0x28, 0x2d, 0x20, 0x6e, 0x20, 0x31, 0x29, 0x20,
+    0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x7d, 0x0a, 0x7d, 0x29,
+    0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x4c, 0x61, 0x73, 0x74, 0x20, 0x49, 0x74,
+    0x65, 0x6d, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x6c, 0x61, 0x73,
+    0x74, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x6e, 0x74, 0x68, 0x20, 0x28, 0x2d,
+    0x20, 0x28, 0x6c, 0x65, 0x6e, 0x20, 0x6c, 0x29, 0x20, 0x31, 0x29, 0x20,
+    0x6c, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x54, 0x61, 0x6b, 0x65,
+    0x20, 0x4e, 0x20, 0x49, 0x74, 0x65, 0x6d, 0x73, 0x0a, 0x28, 0x66, 0x75,
+    0x6e, 0x20, 0x7b, 0x74, 0x61, 0x6b, 0x65, 0x20, 0x6e, 0x20, 0x6c, 0x7d,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d,
+    0x3d, 0x20, 0x6e, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7b, 0x4e, 0x69, 0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28,
+    0x68, 0x65, 0x61, 0x64, 0x20, 0x6c, 0x29, 0x20, 0x28, 0x74, 0x61, 0x6b,
+    0x65, 0x20, 0x28, 0x2d, 0x20, 0x6e, 0x20, 0x31, 0x29, 0x20, 0x28, 0x74,
+    0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a,
+    0x0a, 0x3b, 0x3b, 0x20, 0x54, 0x61, 0x6b, 0x65, 0x20, 0x57, 0x68, 0x69,
+    0x6c, 0x65, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x74, 0x61, 0x6b,
+    0x65, 0x2d, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x66, 0x20, 0x6c, 0x7d,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e,
+    0x6f, 0x74, 0x20, 0x28, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x66,
+    0x20, 0x28, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6c, 0x29, 0x29, 0x29, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x4e, 0x69, 0x6c,
+    0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x6a,
+    0x6f, 0x69, 0x6e, 0x20, 0x28, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6c, 0x29,
+    0x20, 0x28, 0x74, 0x61, 0x6b, 0x65, 0x2d, 0x77, 0x68, 0x69, 0x6c, 0x65,
+    0x20, 0x66, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29, 0x29,
+    0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x44, 0x72, 0x6f,
+    0x70, 0x20, 0x4e, 0x20, 0x49, 0x74, 0x65, 0x6d, 0x73, 0x0a, 0x28, 0x66,
+    0x75, 0x6e, 0x20, 0x7b, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x6e, 0x20, 0x6c,
+    0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+    0x3d, 0x3d, 0x20, 0x6e, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x28, 0x2d,
+    0x20, 0x6e, 0x20, 0x31, 0x29, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20,
+    0x6c, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x44,
+    0x72, 0x6f, 0x70, 0x20, 0x57, 0x68, 0x69, 0x6c, 0x65, 0x0a, 0x28, 0x66,
+    0x75, 0x6e, 0x20, 0x7b, 0x64, 0x72, 0x6f, 0x70, 0x2d, 0x77, 0x68, 0x69,
+    0x6c, 0x65, 0x20, 0x66, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x6f, 0x74, 0x20, 0x28, 0x75,
+    0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x66, 0x20, 0x28, 0x68, 0x65, 0x61,
+    0x64, 0x20, 0x6c, 0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7b, 0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7b, 0x64, 0x72, 0x6f, 0x70, 0x2d, 0x77, 0x68, 0x69,
+    0x6c, 0x65, 0x20, 0x66, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c,
+    0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x53, 0x70,
+    0x6c, 0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x4e, 0x74, 0x68, 0x0a, 0x28,
+    0x66, 0x75, 0x6e, 0x20, 0x7b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x6e,
+    0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x28, 0x74,
+    0x61, 0x6b, 0x65, 0x20, 0x6e, 0x20, 0x6c, 0x29, 0x20, 0x28, 0x64, 0x72,
+    0x6f, 0x70, 0x20, 0x6e, 0x20, 0x6c, 0x29, 0x7d, 0x29, 0x0a, 0x0a, 0x3b,
+    0x3b, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x65, 0x78,
+    0x69, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x69, 0x6e, 0x20, 0x78, 0x20, 0x6c,
+    0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+    0x3d, 0x3d, 0x20, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x29, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x46, 0x61, 0x6c, 0x73, 0x65,
+    0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x69,
+    0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x78, 0x20, 0x28, 0x66, 0x73, 0x74,
+    0x20, 0x6c, 0x29, 0x29, 0x20, 0x7b, 0x54, 0x72, 0x75, 0x65, 0x7d, 0x20,
+    0x7b, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x78, 0x20, 0x28, 0x74, 0x61, 0x69,
+    0x6c, 0x20, 0x6c, 0x29, 0x7d, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b,
+    0x3b, 0x20, 0x46, 0x69, 0x6e, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+    0x66, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x0a, 0x28, 0x66, 0x75, 0x6e,
+    0x20, 0x7b, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x20, 0x78, 0x20, 0x6c,
+    0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+    0x3d, 0x3d, 0x20, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x29, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x65, 0x72, 0x72, 0x6f, 0x72,
+    0x20, 0x22, 0x4e, 0x6f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+    0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x64, 0x6f, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x3d, 0x20,
+    0x7b, 0x6b, 0x65, 0x79, 0x7d, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20, 0x28,
+    0x66, 0x73, 0x74, 0x20, 0x6c, 0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x3d, 0x20,
+    0x7b, 0x76, 0x61, 0x6c, 0x7d, 0x20, 0x28, 0x73, 0x6e, 0x64, 0x20, 0x28,
+    0x66, 0x73, 0x74, 0x20, 0x6c, 0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x66,
+    0x20, 0x28, 0x3d, 0x3d, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x78, 0x29, 0x20,
+    0x7b, 0x76, 0x61, 0x6c, 0x7d, 0x20, 0x7b, 0x6c, 0x6f, 0x6f, 0x6b, 0x75,
+    0x70, 0x20, 0x78, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c, 0x29,
+    0x7d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+    0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x5a, 0x69, 0x70, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x7a, 0x69, 0x70, 0x20, 0x78, 0x20,
+    0x79, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x6f, 0x72, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x78, 0x20, 0x4e, 0x69,
+    0x6c, 0x29, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x79, 0x20, 0x4e, 0x69, 0x6c,
+    0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x4e, 0x69, 0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x7b, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28, 0x6c, 0x69, 0x73, 0x74,
+    0x20, 0x28, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28, 0x68, 0x65, 0x61, 0x64,
+    0x20, 0x78, 0x29, 0x20, 0x28, 0x68, 0x65, 0x61, 0x64, 0x20, 0x79, 0x29,
+    0x29, 0x29, 0x20, 0x28, 0x7a, 0x69, 0x70, 0x20, 0x28, 0x74, 0x61, 0x69,
+    0x6c, 0x20, 0x78, 0x29, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x79,
+    0x29, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x55,
+    0x6e, 0x7a, 0x69, 0x70, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x75,
+    0x6e, 0x7a, 0x69, 0x70, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x6c, 0x20, 0x4e,
+    0x69, 0x6c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x7b, 0x7b, 0x4e, 0x69, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x7d, 0x7d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x64, 0x6f, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x28, 0x3d, 0x20, 0x7b, 0x78, 0x7d, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20,
+    0x6c, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x28, 0x3d, 0x20, 0x7b, 0x78, 0x73, 0x7d, 0x20,
+    0x28, 0x75, 0x6e, 0x7a, 0x69, 0x70, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c,
+    0x20, 0x6c, 0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6c, 0x69, 0x73, 0x74, 0x20,
+    0x28, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28, 0x68, 0x65, 0x61, 0x64, 0x20,
+    0x78, 0x29, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20, 0x78, 0x73, 0x29, 0x29,
+    0x20, 0x28, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c,
+    0x20, 0x78, 0x29, 0x20, 0x28, 0x73, 0x6e, 0x64, 0x20, 0x78, 0x73, 0x29,
+    0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+    0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x4d, 0x61, 0x70, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x6d, 0x61, 0x70, 0x20, 0x66, 0x20,
+    0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x3d, 0x3d, 0x20, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x29, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x4e, 0x69, 0x6c, 0x7d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x6a, 0x6f,
+    0x69, 0x6e, 0x20, 0x28, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x28, 0x66, 0x20,
+    0x28, 0x66, 0x73, 0x74, 0x20, 0x6c, 0x29, 0x29, 0x29, 0x20, 0x28, 0x6d,
+    0x61, 0x70, 0x20, 0x66, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x6c,
+    0x29, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x46,
+    0x69, 0x6c, 0x74, 0x65, 0x72, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b,
+    0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x66, 0x20, 0x6c, 0x7d, 0x20,
+    0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d,
+    0x20, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x4e, 0x69, 0x6c, 0x7d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x6a, 0x6f, 0x69, 0x6e, 0x20,
+    0x28, 0x69, 0x66, 0x20, 0x28, 0x66, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20,
+    0x6c, 0x29, 0x29, 0x20, 0x7b, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6c, 0x7d,
+    0x20, 0x7b, 0x4e, 0x69, 0x6c, 0x7d, 0x29, 0x20, 0x28, 0x66, 0x69, 0x6c,
+    0x74, 0x65, 0x72, 0x20, 0x66, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20,
+    0x6c, 0x29, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20,
+    0x46, 0x6f, 0x6c, 0x64, 0x20, 0x4c, 0x65, 0x66, 0x74, 0x0a, 0x28, 0x66,
+    0x75, 0x6e, 0x20, 0x7b, 0x66, 0x6f, 0x6c, 0x64, 0x6c, 0x20, 0x66, 0x20,
+    0x7a, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x6c, 0x20, 0x4e, 0x69, 0x6c, 0x29,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x7a, 0x7d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x66, 0x6f,
+    0x6c, 0x64, 0x6c, 0x20, 0x66, 0x20, 0x28, 0x66, 0x20, 0x7a, 0x20, 0x28,
+    0x66, 0x73, 0x74, 0x20, 0x6c, 0x29, 0x29, 0x20, 0x28, 0x74, 0x61, 0x69,
+    0x6c, 0x20, 0x6c, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b,
+    0x20, 0x46, 0x6f, 0x6c, 0x64, 0x20, 0x52, 0x69, 0x67, 0x68, 0x74, 0x0a,
+    0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x66, 0x6f, 0x6c, 0x64, 0x72, 0x20,
+    0x66, 0x20, 0x7a, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x6c, 0x20, 0x4e, 0x69,
+    0x6c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x7a, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x66, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20, 0x6c, 0x29, 0x20, 0x28, 0x66,
+    0x6f, 0x6c, 0x64, 0x72, 0x20, 0x66, 0x20, 0x7a, 0x20, 0x28, 0x74, 0x61,
+    0x69, 0x6c, 0x20, 0x6c, 0x29, 0x29, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a,
+    0x3b, 0x3b, 0x20, 0x53, 0x75, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x50,
+    0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20,
+    0x7b, 0x73, 0x75, 0x6d, 0x20, 0x6c, 0x7d, 0x20, 0x7b, 0x66, 0x6f, 0x6c,
+    0x64, 0x20, 0x2b, 0x20, 0x30, 0x20, 0x6c, 0x7d, 0x29, 0x0a, 0x28, 0x66,
+    0x75, 0x6e, 0x20, 0x7b, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20,
+    0x6c, 0x7d, 0x20, 0x7b, 0x66, 0x6f, 0x6c, 0x64, 0x20, 0x2a, 0x20, 0x31,
+    0x20, 0x6c, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x43, 0x6f, 0x6e, 0x64,
+    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x45, 0x78, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x53,
+    0x65, 0x6c, 0x65, 0x63, 0x74, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b,
+    0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x26, 0x20, 0x63, 0x73, 0x7d,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d,
+    0x3d, 0x20, 0x63, 0x73, 0x20, 0x4e, 0x69, 0x6c, 0x29, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x65, 0x72, 0x72, 0x6f, 0x72,
+    0x20, 0x22, 0x4e, 0x6f, 0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x7d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x69, 0x66, 0x20, 0x28,
+    0x66, 0x73, 0x74, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20, 0x63, 0x73, 0x29,
+    0x29, 0x20, 0x7b, 0x73, 0x6e, 0x64, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20,
+    0x63, 0x73, 0x29, 0x7d, 0x20, 0x7b, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b,
+    0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x28, 0x74, 0x61, 0x69,
+    0x6c, 0x20, 0x63, 0x73, 0x29, 0x7d, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a,
+    0x3b, 0x3b, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+    0x0a, 0x28, 0x64, 0x65, 0x66, 0x20, 0x7b, 0x6f, 0x74, 0x68, 0x65, 0x72,
+    0x77, 0x69, 0x73, 0x65, 0x7d, 0x20, 0x54, 0x72, 0x75, 0x65, 0x29, 0x0a,
+    0x0a, 0x3b, 0x3b, 0x20, 0x43, 0x61, 0x73, 0x65, 0x0a, 0x28, 0x66, 0x75,
+    0x6e, 0x20, 0x7b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x78, 0x20, 0x26, 0x20,
+    0x63, 0x73, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x3d, 0x3d, 0x20, 0x63, 0x73, 0x20, 0x4e, 0x69, 0x6c, 0x29,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x65, 0x72,
+    0x72, 0x6f, 0x72, 0x20, 0x22, 0x4e, 0x6f, 0x20, 0x43, 0x61, 0x73, 0x65,
+    0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d,
+    0x20, 0x78, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20, 0x28, 0x66, 0x73, 0x74,
+    0x20, 0x63, 0x73, 0x29, 0x29, 0x29, 0x20, 0x7b, 0x73, 0x6e, 0x64, 0x20,
+    0x28, 0x66, 0x73, 0x74, 0x20, 0x63, 0x73, 0x29, 0x7d, 0x20, 0x7b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
+    0x28, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x28, 0x6c, 0x69, 0x73, 0x74, 0x20,
+    0x78, 0x29, 0x20, 0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x63, 0x73, 0x29,
+    0x29, 0x7d, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x20, 0x4e, 0x75,
+    0x6d, 0x65, 0x72, 0x69, 0x63, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x73, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x4d, 0x69, 0x6e, 0x69,
+    0x6d, 0x75, 0x6d, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x6d, 0x69,
+    0x6e, 0x20, 0x26, 0x20, 0x78, 0x73, 0x7d, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x28, 0x74, 0x61,
+    0x69, 0x6c, 0x20, 0x78, 0x73, 0x29, 0x20, 0x4e, 0x69, 0x6c, 0x29, 0x20,
+    0x7b, 0x66, 0x73, 0x74, 0x20, 0x78, 0x73, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7b, 0x64, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x28, 0x3d, 0x20, 0x7b, 0x72, 0x65, 0x73, 0x74, 0x7d, 0x20, 0x28,
+    0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x6d, 0x69, 0x6e, 0x20, 0x28,
+    0x74, 0x61, 0x69, 0x6c, 0x20, 0x78, 0x73, 0x29, 0x29, 0x29, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x3d, 0x20, 0x7b, 0x69,
+    0x74, 0x65, 0x6d, 0x7d, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20, 0x78, 0x73,
+    0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+    0x69, 0x66, 0x20, 0x28, 0x3c, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20, 0x72,
+    0x65, 0x73, 0x74, 0x29, 0x20, 0x7b, 0x69, 0x74, 0x65, 0x6d, 0x7d, 0x20,
+    0x7b, 0x72, 0x65, 0x73, 0x74, 0x7d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x0a, 0x3b, 0x3b, 0x20, 0x4d, 0x61, 0x78,
+    0x69, 0x6d, 0x75, 0x6d, 0x0a, 0x28, 0x66, 0x75, 0x6e, 0x20, 0x7b, 0x6d,
+    0x61, 0x78, 0x20, 0x26, 0x20, 0x78, 0x73, 0x7d, 0x20, 0x7b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x3d, 0x3d, 0x20, 0x28, 0x74,
+    0x61, 0x69, 0x6c, 0x20, 0x78, 0x73, 0x29, 0x20, 0x4e, 0x69, 0x6c, 0x29,
+    0x20, 0x7b, 0x66, 0x73, 0x74, 0x20, 0x78, 0x73, 0x7d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x7b, 0x64, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x28, 0x3d, 0x20, 0x7b, 0x72, 0x65, 0x73, 0x74, 0x7d, 0x20,
+    0x28, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x6d, 0x61, 0x78, 0x20,
+    0x28, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x78, 0x73, 0x29, 0x29, 0x29, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x3d, 0x20, 0x7b,
+    0x69, 0x74, 0x65, 0x6d, 0x7d, 0x20, 0x28, 0x66, 0x73, 0x74, 0x20, 0x78,
+    0x73, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x28, 0x69, 0x66, 0x20, 0x28, 0x3e, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20,
+    0x72, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7b, 0x69, 0x74, 0x65, 0x6d, 0x7d,
+    0x20, 0x7b, 0x72, 0x65, 0x73, 0x74, 0x7d, 0x29, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7d, 0x0a, 0x7d, 0x29, 0x0a, 0x7b, 0x02, 0x59, 0x03, 0x4e, 0x69,
+    0x6c, 0x7b, 0x00, 0x7b, 0x02, 0x59, 0x04, 0x54, 0x72, 0x75, 0x65, 0x4e,
+    0x02, 0x7b, 0x02, 0x59, 0x05, 0x46, 0x61, 0x6c, 0x73, 0x65, 0x4e, 0x00,
+    0x7b, 0x02, 0x59, 0x03, 0x66, 0x75, 0x6e, 0x5c, 0x7b, 0x02, 0x59, 0x01,
+    0x66, 0x59, 0x01, 0x61, 0x7b, 0x03, 0x59, 0x03, 0x64, 0x65, 0x66, 0x28,
+    0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x66, 0x28, 0x03,
+    0x59, 0x01, 0x5c, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59,
+    0x01, 0x66, 0x59, 0x01, 0x61, 0x00, 0x7b, 0x02, 0x59, 0x06, 0x75, 0x6e,
+    0x70, 0x61, 0x63, 0x6b, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x66, 0x59, 0x01,
+    0x6c, 0x7b, 0x02, 0x59, 0x04, 0x65, 0x76, 0x61, 0x6c, 0x28, 0x03, 0x59,
+    0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x02, 0x59, 0x04, 0x6c, 0x69, 0x73,
+    0x74, 0x59, 0x01, 0x66, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x04,
+    0x70, 0x61, 0x63, 0x6b, 0x5c, 0x7b, 0x03, 0x59, 0x01, 0x66, 0x59, 0x01,
+    0x26, 0x59, 0x02, 0x78, 0x73, 0x7b, 0x02, 0x59, 0x01, 0x66, 0x59, 0x02,
+    0x78, 0x73, 0x00, 0x7b, 0x02, 0x59, 0x05, 0x63, 0x75, 0x72, 0x72, 0x79,
+    0x5c, 0x7b, 0x02, 0x59, 0x01, 0x66, 0x59, 0x01, 0x6c, 0x7b, 0x02, 0x59,
+    0x04, 0x65, 0x76, 0x61, 0x6c, 0x28, 0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69,
+    0x6e, 0x28, 0x02, 0x59, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x59, 0x01, 0x66,
+    0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x07, 0x75, 0x6e, 0x63, 0x75,
+    0x72, 0x72, 0x79, 0x5c, 0x7b, 0x03, 0x59, 0x01, 0x66, 0x59, 0x01, 0x26,
+    0x59, 0x02, 0x78, 0x73, 0x7b, 0x02, 0x59, 0x01, 0x66, 0x59, 0x02, 0x78,
+    0x73, 0x00, 0x7b, 0x02, 0x59, 0x03, 0x6c, 0x65, 0x74, 0x5c, 0x7b, 0x01,
+    0x59, 0x01, 0x61, 0x7b, 0x01, 0x28, 0x02, 0x28, 0x03, 0x59, 0x01, 0x5c,
+    0x7b, 0x01, 0x59, 0x01, 0x5f, 0x59, 0x01, 0x61, 0x28, 0x00, 0x00, 0x7b,
+    0x02, 0x59, 0x02, 0x69, 0x73, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x78, 0x59,
+    0x01, 0x79, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02,
+    0x3d, 0x3d, 0x59, 0x01, 0x78, 0x59, 0x01, 0x79, 0x7b, 0x01, 0x59, 0x04,
+    0x54, 0x72, 0x75, 0x65, 0x7b, 0x01, 0x59, 0x05, 0x46, 0x61, 0x6c, 0x73,
+    0x65, 0x00, 0x7b, 0x02, 0x59, 0x03, 0x6e, 0x6f, 0x74, 0x5c, 0x7b, 0x01,
+    0x59, 0x01, 0x78, 0x7b, 0x03, 0x59, 0x01, 0x2d, 0x4e, 0x02, 0x59, 0x01,
+    0x78, 0x00, 0x7b, 0x02, 0x59, 0x02, 0x6f, 0x72, 0x5c, 0x7b, 0x02, 0x59,
+    0x01, 0x78, 0x59, 0x01, 0x79, 0x7b, 0x03, 0x59, 0x01, 0x2b, 0x59, 0x01,
+    0x78, 0x59, 0x01, 0x79, 0x00, 0x7b, 0x02, 0x59, 0x03, 0x61, 0x6e, 0x64,
+    0x5c, 0x7b, 0x02, 0x59, 0x01, 0x78, 0x59, 0x01, 0x79, 0x7b, 0x03, 0x59,
+    0x01, 0x2a, 0x59, 0x01, 0x78, 0x59, 0x01, 0x79, 0x00, 0x7b, 0x02, 0x59,
+    0x04, 0x66, 0x6c, 0x69, 0x70, 0x5c, 0x7b, 0x03, 0x59, 0x01, 0x66, 0x59,
+    0x01, 0x61, 0x59, 0x01, 0x62, 0x7b, 0x03, 0x59, 0x01, 0x66, 0x59, 0x01,
+    0x62, 0x59, 0x01, 0x61, 0x00, 0x7b, 0x02, 0x59, 0x05, 0x67, 0x68, 0x6f,
+    0x73, 0x74, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x26, 0x59, 0x02, 0x78, 0x73,
+    0x7b, 0x02, 0x59, 0x04, 0x65, 0x76, 0x61, 0x6c, 0x59, 0x02, 0x78, 0x73,
+    0x00, 0x7b, 0x02, 0x59, 0x07, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x65,
+    0x5c, 0x7b, 0x03, 0x59, 0x01, 0x66, 0x59, 0x01, 0x67, 0x59, 0x01, 0x78,
+    0x7b, 0x02, 0x59, 0x01, 0x66, 0x28, 0x02, 0x59, 0x01, 0x67, 0x59, 0x01,
+    0x78, 0x00, 0x7b, 0x02, 0x59, 0x02, 0x64, 0x6f, 0x5c, 0x7b, 0x02, 0x59,
+    0x01, 0x26, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28,
+    0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6c, 0x59, 0x03, 0x4e, 0x69,
+    0x6c, 0x7b, 0x01, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x02, 0x59, 0x04,
+    0x6c, 0x61, 0x73, 0x74, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x03,
+    0x66, 0x73, 0x74, 0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x02, 0x59,
+    0x04, 0x65, 0x76, 0x61, 0x6c, 0x28, 0x02, 0x59, 0x04, 0x68, 0x65, 0x61,
+    0x64, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x03, 0x73, 0x6e, 0x64,
+    0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x02, 0x59, 0x04, 0x65, 0x76,
+    0x61, 0x6c, 0x28, 0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x28, 0x02,
+    0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02,
+    0x59, 0x03, 0x74, 0x72, 0x64, 0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b,
+    0x02, 0x59, 0x04, 0x65, 0x76, 0x61, 0x6c, 0x28, 0x02, 0x59, 0x04, 0x68,
+    0x65, 0x61, 0x64, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x28,
+    0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b,
+    0x02, 0x59, 0x03, 0x6c, 0x65, 0x6e, 0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c,
+    0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d,
+    0x59, 0x01, 0x6c, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x4e, 0x00,
+    0x7b, 0x03, 0x59, 0x01, 0x2b, 0x4e, 0x02, 0x28, 0x02, 0x59, 0x03, 0x6c,
+    0x65, 0x6e, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01,
+    0x6c, 0x00, 0x7b, 0x02, 0x59, 0x04, 0x69, 0x6e, 0x69, 0x74, 0x5c, 0x7b,
+    0x01, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03,
+    0x59, 0x02, 0x3d, 0x3d, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c,
+    0x59, 0x01, 0x6c, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x59, 0x03,
+    0x4e, 0x69, 0x6c, 0x7b, 0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28,
+    0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x6c, 0x28, 0x02,
+    0x59, 0x04, 0x69, 0x6e, 0x69, 0x74, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61,
+    0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x07, 0x72, 0x65,
+    0x76, 0x65, 0x72, 0x73, 0x65, 0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b,
+    0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59,
+    0x01, 0x6c, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x59, 0x03, 0x4e,
+    0x69, 0x6c, 0x7b, 0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x02,
+    0x59, 0x07, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x28, 0x02, 0x59,
+    0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x28, 0x02, 0x59, 0x04,
+    0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x03,
+    0x6e, 0x74, 0x68, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x6e, 0x59, 0x01, 0x6c,
+    0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d,
+    0x59, 0x01, 0x6e, 0x4e, 0x00, 0x7b, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74,
+    0x59, 0x01, 0x6c, 0x7b, 0x03, 0x59, 0x03, 0x6e, 0x74, 0x68, 0x28, 0x03,
+    0x59, 0x01, 0x2d, 0x59, 0x01, 0x6e, 0x4e, 0x02, 0x28, 0x02, 0x59, 0x04,
+    0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x04,
+    0x6c, 0x61, 0x73, 0x74, 0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x03,
+    0x59, 0x03, 0x6e, 0x74, 0x68, 0x28, 0x03, 0x59, 0x01, 0x2d, 0x28, 0x02,
+    0x59, 0x03, 0x6c, 0x65, 0x6e, 0x59, 0x01, 0x6c, 0x4e, 0x02, 0x59, 0x01,
+    0x6c, 0x00, 0x7b, 0x02, 0x59, 0x04, 0x74, 0x61, 0x6b, 0x65, 0x5c, 0x7b,
+    0x02, 0x59, 0x01, 0x6e, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02, 0x69,
+    0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6e, 0x4e, 0x00,
+    0x7b, 0x01, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x03, 0x59, 0x04, 0x6a,
+    0x6f, 0x69, 0x6e, 0x28, 0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x59,
+    0x01, 0x6c, 0x28, 0x03, 0x59, 0x04, 0x74, 0x61, 0x6b, 0x65, 0x28, 0x03,
+    0x59, 0x01, 0x2d, 0x59, 0x01, 0x6e, 0x4e, 0x02, 0x28, 0x02, 0x59, 0x04,
+    0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x0a,
+    0x74, 0x61, 0x6b, 0x65, 0x2d, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x5c, 0x7b,
+    0x02, 0x59, 0x01, 0x66, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02, 0x69,
+    0x66, 0x28, 0x02, 0x59, 0x03, 0x6e, 0x6f, 0x74, 0x28, 0x03, 0x59, 0x06,
+    0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x59, 0x01, 0x66, 0x28, 0x02, 0x59,
+    0x04, 0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x6c, 0x7b, 0x01, 0x59, 0x03,
+    0x4e, 0x69, 0x6c, 0x7b, 0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28,
+    0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x6c, 0x28, 0x03,
+    0x59, 0x0a, 0x74, 0x61, 0x6b, 0x65, 0x2d, 0x77, 0x68, 0x69, 0x6c, 0x65,
+    0x59, 0x01, 0x66, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59,
+    0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x04, 0x64, 0x72, 0x6f, 0x70, 0x5c,
+    0x7b, 0x02, 0x59, 0x01, 0x6e, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02,
+    0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6e, 0x4e,
+    0x00, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x03, 0x59, 0x04, 0x64, 0x72,
+    0x6f, 0x70, 0x28, 0x03, 0x59, 0x01, 0x2d, 0x59, 0x01, 0x6e, 0x4e, 0x02,
+    0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00,
+    0x7b, 0x02, 0x59, 0x0a, 0x64, 0x72, 0x6f, 0x70, 0x2d, 0x77, 0x68, 0x69,
+    0x6c, 0x65, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x66, 0x59, 0x01, 0x6c, 0x7b,
+    0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x02, 0x59, 0x03, 0x6e, 0x6f, 0x74,
+    0x28, 0x03, 0x59, 0x06, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x59, 0x01,
+    0x66, 0x28, 0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x6c,
+    0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x03, 0x59, 0x0a, 0x64, 0x72, 0x6f,
+    0x70, 0x2d, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x59, 0x01, 0x66, 0x28, 0x02,
+    0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02,
+    0x59, 0x05, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x5c, 0x7b, 0x02, 0x59, 0x01,
+    0x6e, 0x59, 0x01, 0x6c, 0x7b, 0x03, 0x59, 0x04, 0x6c, 0x69, 0x73, 0x74,
+    0x28, 0x03, 0x59, 0x04, 0x74, 0x61, 0x6b, 0x65, 0x59, 0x01, 0x6e, 0x59,
+    0x01, 0x6c, 0x28, 0x03, 0x59, 0x04, 0x64, 0x72, 0x6f, 0x70, 0x59, 0x01,
+    0x6e, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x02, 0x69, 0x6e, 0x5c,
+    0x7b, 0x02, 0x59, 0x01, 0x78, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02,
+    0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6c, 0x59,
+    0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x59, 0x05, 0x46, 0x61, 0x6c, 0x73,
+    0x65, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d,
+    0x3d, 0x59, 0x01, 0x78, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74, 0x59,
+    0x01, 0x6c, 0x7b, 0x01, 0x59, 0x04, 0x54, 0x72, 0x75, 0x65, 0x7b, 0x03,
+    0x59, 0x04, 0x65, 0x6c, 0x65, 0x6d, 0x59, 0x01, 0x78, 0x28, 0x02, 0x59,
+    0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59,
+    0x06, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5c, 0x7b, 0x02, 0x59, 0x01,
+    0x78, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03,
+    0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6c, 0x59, 0x03, 0x4e, 0x69, 0x6c,
+    0x7b, 0x02, 0x59, 0x05, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x53, 0x10, 0x4e,
+    0x6f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x46, 0x6f,
+    0x75, 0x6e, 0x64, 0x7b, 0x04, 0x59, 0x02, 0x64, 0x6f, 0x28, 0x03, 0x59,
+    0x01, 0x3d, 0x7b, 0x01, 0x59, 0x03, 0x6b, 0x65, 0x79, 0x28, 0x02, 0x59,
+    0x03, 0x66, 0x73, 0x74, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74, 0x59,
+    0x01, 0x6c, 0x28, 0x03, 0x59, 0x01, 0x3d, 0x7b, 0x01, 0x59, 0x03, 0x76,
+    0x61, 0x6c, 0x28, 0x02, 0x59, 0x03, 0x73, 0x6e, 0x64, 0x28, 0x02, 0x59,
+    0x03, 0x66, 0x73, 0x74, 0x59, 0x01, 0x6c, 0x28, 0x04, 0x59, 0x02, 0x69,
+    0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x03, 0x6b, 0x65, 0x79,
+    0x59, 0x01, 0x78, 0x7b, 0x01, 0x59, 0x03, 0x76, 0x61, 0x6c, 0x7b, 0x03,
+    0x59, 0x06, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x59, 0x01, 0x78, 0x28,
+    0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b,
+    0x02, 0x59, 0x03, 0x7a, 0x69, 0x70, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x78,
+    0x59, 0x01, 0x79, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59,
+    0x02, 0x6f, 0x72, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x78,
+    0x59, 0x03, 0x4e, 0x69, 0x6c, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59,
+    0x01, 0x79, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x59, 0x03, 0x4e,
+    0x69, 0x6c, 0x7b, 0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x02,
+    0x59, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x28, 0x03, 0x59, 0x04, 0x6a, 0x6f,
+    0x69, 0x6e, 0x28, 0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x59, 0x01,
+    0x78, 0x28, 0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x79,
+    0x28, 0x03, 0x59, 0x03, 0x7a, 0x69, 0x70, 0x28, 0x02, 0x59, 0x04, 0x74,
+    0x61, 0x69, 0x6c, 0x59, 0x01, 0x78, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61,
+    0x69, 0x6c, 0x59, 0x01, 0x79, 0x00, 0x7b, 0x02, 0x59, 0x05, 0x75, 0x6e,
+    0x7a, 0x69, 0x70, 0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59,
+    0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6c,
+    0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x7b, 0x02, 0x59, 0x03, 0x4e,
+    0x69, 0x6c, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x04, 0x59, 0x02, 0x64,
+    0x6f, 0x28, 0x03, 0x59, 0x01, 0x3d, 0x7b, 0x01, 0x59, 0x01, 0x78, 0x28,
+    0x02, 0x59, 0x03, 0x66, 0x73, 0x74, 0x59, 0x01, 0x6c, 0x28, 0x03, 0x59,
+    0x01, 0x3d, 0x7b, 0x01, 0x59, 0x02, 0x78, 0x73, 0x28, 0x02, 0x59, 0x05,
+    0x75, 0x6e, 0x7a, 0x69, 0x70, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69,
+    0x6c, 0x59, 0x01, 0x6c, 0x28, 0x03, 0x59, 0x04, 0x6c, 0x69, 0x73, 0x74,
+    0x28, 0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x02, 0x59, 0x04,
+    0x68, 0x65, 0x61, 0x64, 0x59, 0x01, 0x78, 0x28, 0x02, 0x59, 0x03, 0x66,
+    0x73, 0x74, 0x59, 0x02, 0x78, 0x73, 0x28, 0x03, 0x59, 0x04, 0x6a, 0x6f,
+    0x69, 0x6e, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01,
+    0x78, 0x28, 0x02, 0x59, 0x03, 0x73, 0x6e, 0x64, 0x59, 0x02, 0x78, 0x73,
+    0x00, 0x7b, 0x02, 0x59, 0x03, 0x6d, 0x61, 0x70, 0x5c, 0x7b, 0x02, 0x59,
+    0x01, 0x66, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28,
+    0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6c, 0x59, 0x03, 0x4e, 0x69,
+    0x6c, 0x7b, 0x01, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x03, 0x59, 0x04,
+    0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x02, 0x59, 0x04, 0x6c, 0x69, 0x73, 0x74,
+    0x28, 0x02, 0x59, 0x01, 0x66, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74,
+    0x59, 0x01, 0x6c, 0x28, 0x03, 0x59, 0x03, 0x6d, 0x61, 0x70, 0x59, 0x01,
+    0x66, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c,
+    0x00, 0x7b, 0x02, 0x59, 0x06, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x5c,
+    0x7b, 0x02, 0x59, 0x01, 0x66, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02,
+    0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6c, 0x59,
+    0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b,
+    0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x04, 0x59, 0x02, 0x69,
+    0x66, 0x28, 0x02, 0x59, 0x01, 0x66, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73,
+    0x74, 0x59, 0x01, 0x6c, 0x7b, 0x02, 0x59, 0x04, 0x68, 0x65, 0x61, 0x64,
+    0x59, 0x01, 0x6c, 0x7b, 0x01, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x28, 0x03,
+    0x59, 0x06, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x59, 0x01, 0x66, 0x28,
+    0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b,
+    0x02, 0x59, 0x05, 0x66, 0x6f, 0x6c, 0x64, 0x6c, 0x5c, 0x7b, 0x03, 0x59,
+    0x01, 0x66, 0x59, 0x01, 0x7a, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x02,
+    0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x6c, 0x59,
+    0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x59, 0x01, 0x7a, 0x7b, 0x04, 0x59,
+    0x05, 0x66, 0x6f, 0x6c, 0x64, 0x6c, 0x59, 0x01, 0x66, 0x28, 0x03, 0x59,
+    0x01, 0x66, 0x59, 0x01, 0x7a, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74,
+    0x59, 0x01, 0x6c, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59,
+    0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x05, 0x66, 0x6f, 0x6c, 0x64, 0x72,
+    0x5c, 0x7b, 0x03, 0x59, 0x01, 0x66, 0x59, 0x01, 0x7a, 0x59, 0x01, 0x6c,
+    0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d,
+    0x59, 0x01, 0x6c, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x01, 0x59, 0x01,
+    0x7a, 0x7b, 0x03, 0x59, 0x01, 0x66, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73,
+    0x74, 0x59, 0x01, 0x6c, 0x28, 0x04, 0x59, 0x05, 0x66, 0x6f, 0x6c, 0x64,
+    0x72, 0x59, 0x01, 0x66, 0x59, 0x01, 0x7a, 0x28, 0x02, 0x59, 0x04, 0x74,
+    0x61, 0x69, 0x6c, 0x59, 0x01, 0x6c, 0x00, 0x7b, 0x02, 0x59, 0x03, 0x73,
+    0x75, 0x6d, 0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x04,
+    0x66, 0x6f, 0x6c, 0x64, 0x59, 0x01, 0x2b, 0x4e, 0x00, 0x59, 0x01, 0x6c,
+    0x00, 0x7b, 0x02, 0x59, 0x07, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74,
+    0x5c, 0x7b, 0x01, 0x59, 0x01, 0x6c, 0x7b, 0x04, 0x59, 0x04, 0x66, 0x6f,
+    0x6c, 0x64, 0x59, 0x01, 0x2a, 0x4e, 0x02, 0x59, 0x01, 0x6c, 0x00, 0x7b,
+    0x02, 0x59, 0x06, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x5c, 0x7b, 0x02,
+    0x59, 0x01, 0x26, 0x59, 0x02, 0x63, 0x73, 0x7b, 0x04, 0x59, 0x02, 0x69,
+    0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x02, 0x63, 0x73, 0x59,
+    0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x02, 0x59, 0x05, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x53, 0x12, 0x4e, 0x6f, 0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x7b, 0x04, 0x59,
+    0x02, 0x69, 0x66, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74, 0x28, 0x02,
+    0x59, 0x03, 0x66, 0x73, 0x74, 0x59, 0x02, 0x63, 0x73, 0x7b, 0x02, 0x59,
+    0x03, 0x73, 0x6e, 0x64, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74, 0x59,
+    0x02, 0x63, 0x73, 0x7b, 0x03, 0x59, 0x06, 0x75, 0x6e, 0x70, 0x61, 0x63,
+    0x6b, 0x59, 0x06, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x02, 0x59,
+    0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x02, 0x63, 0x73, 0x00, 0x7b, 0x02,
+    0x59, 0x09, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x4e,
+    0x02, 0x7b, 0x02, 0x59, 0x04, 0x63, 0x61, 0x73, 0x65, 0x5c, 0x7b, 0x03,
+    0x59, 0x01, 0x78, 0x59, 0x01, 0x26, 0x59, 0x02, 0x63, 0x73, 0x7b, 0x04,
+    0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x02,
+    0x63, 0x73, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x02, 0x59, 0x05, 0x65,
+    0x72, 0x72, 0x6f, 0x72, 0x53, 0x0d, 0x4e, 0x6f, 0x20, 0x43, 0x61, 0x73,
+    0x65, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x7b, 0x04, 0x59, 0x02, 0x69,
+    0x66, 0x28, 0x03, 0x59, 0x02, 0x3d, 0x3d, 0x59, 0x01, 0x78, 0x28, 0x02,
+    0x59, 0x03, 0x66, 0x73, 0x74, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74,
+    0x59, 0x02, 0x63, 0x73, 0x7b, 0x02, 0x59, 0x03, 0x73, 0x6e, 0x64, 0x28,
+    0x02, 0x59, 0x03, 0x66, 0x73, 0x74, 0x59, 0x02, 0x63, 0x73, 0x7b, 0x03,
+    0x59, 0x06, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x59, 0x04, 0x63, 0x61,
+    0x73, 0x65, 0x28, 0x03, 0x59, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x02,
+    0x59, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x59, 0x01, 0x78, 0x28, 0x02, 0x59,
+    0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x02, 0x63, 0x73, 0x00, 0x7b, 0x02,
+    0x59, 0x03, 0x6d, 0x69, 0x6e, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x26, 0x59,
+    0x02, 0x78, 0x73, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59,
+    0x02, 0x3d, 0x3d, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59,
+    0x02, 0x78, 0x73, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x02, 0x59, 0x03,
+    0x66, 0x73, 0x74, 0x59, 0x02, 0x78, 0x73, 0x7b, 0x04, 0x59, 0x02, 0x64,
+    0x6f, 0x28, 0x03, 0x59, 0x01, 0x3d, 0x7b, 0x01, 0x59, 0x04, 0x72, 0x65,
+    0x73, 0x74, 0x28, 0x03, 0x59, 0x06, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b,
+    0x59, 0x03, 0x6d, 0x69, 0x6e, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69,
+    0x6c, 0x59, 0x02, 0x78, 0x73, 0x28, 0x03, 0x59, 0x01, 0x3d, 0x7b, 0x01,
+    0x59, 0x04, 0x69, 0x74, 0x65, 0x6d, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73,
+    0x74, 0x59, 0x02, 0x78, 0x73, 0x28, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28,
+    0x03, 0x59, 0x01, 0x3c, 0x59, 0x04, 0x69, 0x74, 0x65, 0x6d, 0x59, 0x04,
+    0x72, 0x65, 0x73, 0x74, 0x7b, 0x01, 0x59, 0x04, 0x69, 0x74, 0x65, 0x6d,
+    0x7b, 0x01, 0x59, 0x04, 0x72, 0x65, 0x73, 0x74, 0x00, 0x7b, 0x02, 0x59,
+    0x03, 0x6d, 0x61, 0x78, 0x5c, 0x7b, 0x02, 0x59, 0x01, 0x26, 0x59, 0x02,
+    0x78, 0x73, 0x7b, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03, 0x59, 0x02,
+    0x3d, 0x3d, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c, 0x59, 0x02,
+    0x78, 0x73, 0x59, 0x03, 0x4e, 0x69, 0x6c, 0x7b, 0x02, 0x59, 0x03, 0x66,
+    0x73, 0x74, 0x59, 0x02, 0x78, 0x73, 0x7b, 0x04, 0x59, 0x02, 0x64, 0x6f,
+    0x28, 0x03, 0x59, 0x01, 0x3d, 0x7b, 0x01, 0x59, 0x04, 0x72, 0x65, 0x73,
+    0x74, 0x28, 0x03, 0x59, 0x06, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x59,
+    0x03, 0x6d, 0x61, 0x78, 0x28, 0x02, 0x59, 0x04, 0x74, 0x61, 0x69, 0x6c,
+    0x59, 0x02, 0x78, 0x73, 0x28, 0x03, 0x59, 0x01, 0x3d, 0x7b, 0x01, 0x59,
+    0x04, 0x69, 0x74, 0x65, 0x6d, 0x28, 0x02, 0x59, 0x03, 0x66, 0x73, 0x74,
+    0x59, 0x02, 0x78, 0x73, 0x28, 0x04, 0x59, 0x02, 0x69, 0x66, 0x28, 0x03,
+    0x59, 0x01, 0x3e, 0x59, 0x04, 0x69, 0x74, 0x65, 0x6d, 0x59, 0x04, 0x72,
+    0x65, 0x73, 0x74, 0x7b, 0x01, 0x59, 0x04, 0x69, 0x74, 0x65, 0x6d, 0x7b,
+    0x01, 0x59, 0x04, 0x72, 0x65, 0x73, 0x74, 0x00, 0x45,
+};
+
+
+const long limage_prelude_len = sizeof(limage_prelude);
@@ -0,0 +1,358 @@
+/// sigaction, setitimer and clock_gettime are POSIX interfaces.
+#define _XOPEN_SOURCE 700
+
+#include <profile.h>
+#include <lval.h>
+#include <writer.h>
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+    #include <signal.h>
+    #include <sys/time.h>
+#endif  /// _WIN32
+
+#define LPROF_BUCKETS 4096
+#define LPROF_MIN_STACK 64
+
+
+/// Ticks of the timer not charged to a stack yet. Only
+/// ever added to by the signal handler, which may run on
+/// any thread.
+static _Atomic long lprof_ticks = 0;
+
+
+static unsigned long lprof_hash(const char* s)
+{
+    unsigned long h = 14695981039346656037UL;
+
+    for (; *s; s++)
+        h = (h ^ (unsigned char)*s) * 1099511628211UL;
+
+    return h;
+}
+
+
+/// Finds the entry for `key` in `buckets`, adding it if
+/// missing. `key` is copied if `own` is 0 and taken
+/// otherwise.
+static lprof_entry* lprof_entry_get(lprof_entry** buckets, char* key, int own)
+{
+    lprof_entry** b = &buckets[lprof_hash(key) % LPROF_BUCKETS];
+
+    for (lprof_entry* x = *b; x; x = x->next)
+        if (strcmp(x->key, key) == 0)
+        {
+            if (own)
+                free(key);
+
+            return x;
+        }
+
+    lprof_entry* x = malloc(sizeof(lprof_entry));
+
+    if (own)
+        x->key = key;
+    else
+    {
+        x->key = malloc(strlen(key) + 1);
+        strcpy(x->key, key);
+    }
+
+    x->self = 0;
+    x->total = 0;
+    x->stamp = -1;
+    x->next = *b;
+    *b = x;
+    return x;
+}
+
+
+static void lprof_entries_del(lprof_entry** buckets)
+{
+    for (int i = 0; i < LPROF_BUCKETS; i++)
+        while (buckets[i])
+        {
+            lprof_entry* next = buckets[i]->next;
+            free(buckets[i]->key);
+            free(buckets[i]);
+            buckets[i] = next;
+        }
+
+    free(buckets);
+}
+
+
+/// Charges the ticks counted since the last sample to the
+/// current stack of `p`.
+static void lprof_sample(lprof* p)
+{
+    long n = atomic_exchange(&lprof_ticks, 0);
+
+    if (n == 0)
+        return;
+
+    p->samples++;
+
+    lwriter* w = lwriter_str();
+
+    if (p->depth == 0)
+        lwriter_puts(w, "(top)");
+
+    for (int i = 0; i < p->depth; i++)
+    {
+        lprof_entry* f = p->stack[i];
+
+        if (i > 0)
+            lwriter_putc(w, ';');
+
+        lwriter_puts(w, f->key);
+
+        /// Recursive functions are counted in their own
+        /// total once per sample.
+        if (f->stamp != p->samples)
+        {
+            f->stamp = p->samples;
+            f->total += n;
+        }
+    }
+
+    if (p->depth > 0)
+        p->stack[p->depth - 1]->self += n;
+
+    lprof_entry_get(p->stacks, lwriter_take(w), 1)->self += n;
+}
+
+
+void lprof_enter(lprof* p, lval* f)
+{
+    if (lprof_ticks)
+        lprof_sample(p);
+
+    if (p->depth == p->cap)
+    {
+        p->cap *= 2;
+        p->stack = realloc(p->stack, sizeof(lprof_entry*) * p->cap);
+    }
+
+    p->stack[p->depth++] = lprof_entry_get(p->fns, f->sym ? f->sym : "(lambda)", 0);
+}
+
+
+void lprof_leave(lprof* p)
+{
+    if (lprof_ticks)
+        lprof_sample(p);
+
+    p->depth--;
+}
+
+
+static int lprof_by_self(const void* a, const void* b)
+{
+    const lprof_entry* x = *(const lprof_entry* const*)a;
+    const lprof_entry* y = *(const lprof_entry* const*)b;
+
+    if (x->self != y->self)
+        return (x->self < y->self) ? 1 : -1;
+
+    return (x->total < y->total) - (x->total > y->total);
+}
+
+
+/// Writes the table of functions with the most self time,
+/// sharing the `cpu` milliseconds measured between the
+/// samples taken.
+static void lprof_report(lprof* p, double cpu, FILE* out)
+{
+    long ticks = 0;
+    int count = 0;
+
+    for (int i = 0; i < LPROF_BUCKETS; i++)
+        for (lprof_entry* x = p->stacks[i]; x; x = x->next)
+            ticks += x->self;
+
+    for (int i = 0; i < LPROF_BUCKETS; i++)
+        for (lprof_entry* x = p->fns[i]; x; x = x->next)
+            count++;
+
+    lprof_entry** fns = malloc(sizeof(lprof_entry*) * (count ? count : 1));
+    count = 0;
+
+    for (int i = 0; i < LPROF_BUCKETS; i++)
+        for (lprof_entry* x = p->fns[i]; x; x = x->next)
+            fns[count++] = x;
+
+    qsort(fns, count, sizeof(lprof_entry*), lprof_by_self);
+
+    /// The timer fires at the kernel's granularity rather
+    /// than every LPROF_INTERVAL, so a sample is worth its
+    /// share of the CPU time actually used.
+    double ms = ticks ? cpu / ticks : 0;
+    double pct = ticks ? 100.0 / ticks : 0;
+
+    fprintf(out, "%ld samples, %.0fms of CPU time\n\n", ticks, cpu);
+    fprintf(out, "%10s %7s %10s %7s  %s\n", "self", "self%", "total", "total%", "function");
+
+    for (int i = 0; i < count && i < LPROF_TOP && fns[i]->total > 0; i++)
+        fprintf(out, "%8.0fms %6.1f%% %8.0fms %6.1f%%  %s\n",
+                fns[i]->self * ms, fns[i]->self * pct,
+                fns[i]->total * ms, fns[i]->total * pct, fns[i]->key);
+
+    free(fns);
+}
+
+
+/////////////////
+/// Profiling ///
+/////////////////
+
+#ifndef _WIN32
+
+
+/// CPU time used by the process, in milliseconds.
+static double lprof_cpu(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+
+static void lprof_tick(int sig)
+{
+    (void)sig;
+    atomic_fetch_add(&lprof_ticks, 1);
+}
+
+
+/// Sets the SIGPROF timer to fire every `us` microseconds
+/// of CPU time, or stops it if `us` is 0.
+static int lprof_timer(long us)
+{
+    struct itimerval t;
+    t.it_interval.tv_sec = us / 1000000;
+    t.it_interval.tv_usec = us % 1000000;
+    t.it_value = t.it_interval;
+
+    return setitimer(ITIMER_PROF, &t, NULL) == 0;
+}
+
+
+lval* lprof_start(lctx* c)
+{
+    if (c->prof)
+        return lval_err("The instance is already being profiled.");
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = lprof_tick;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+
+    if (sigaction(SIGPROF, &sa, NULL) != 0)
+        return lval_err("Could not handle SIGPROF: %s", strerror(errno));
+
+    lprof* p = malloc(sizeof(lprof));
+    p->cap = LPROF_MIN_STACK;
+    p->depth = 0;
+    p->stack = malloc(sizeof(lprof_entry*) * p->cap);
+    p->fns = calloc(LPROF_BUCKETS, sizeof(lprof_entry*));
+    p->stacks = calloc(LPROF_BUCKETS, sizeof(lprof_entry*));
+    p->samples = 0;
+    p->cpu = lprof_cpu();
+
+    atomic_store(&lprof_ticks, 0);
+    c->prof = p;
+
+    if (!lprof_timer(LPROF_INTERVAL))
+    {
+        lval* err = lval_err("Could not start the profiling timer: %s", strerror(errno));
+        lval_del(lprof_stop(c, NULL, NULL));
+        return err;
+    }
+
+    return lval_sexpr();
+}
+
+
+lval* lprof_stop(lctx* c, char* path, FILE* out)
+{
+    lprof* p = c->prof;
+
+    if (p == NULL)
+        return lval_err("The instance is not being profiled.");
+
+    lprof_timer(0);
+    signal(SIGPROF, SIG_IGN);
+
+    double cpu = lprof_cpu() - p->cpu;
+
+    /// Ticks since the last call or return are charged to
+    /// the top level.
+    lprof_sample(p);
+    c->prof = NULL;
+
+    lval* r = lval_sexpr();
+
+    if (path)
+    {
+        FILE* f = fopen(path, "w");
+        int ok = f != NULL;
+
+        if (f)
+        {
+            lwriter* w = lwriter_file(f);
+
+            for (int i = 0; i < LPROF_BUCKETS; i++)
+                for (lprof_entry* x = p->stacks[i]; x; x = x->next)
+                {
+                    lwriter_puts(w, x->key);
+                    lwriter_putc(w, ' ');
+                    lwriter_num(w, x->self);
+                    lwriter_putc(w, '\n');
+                }
+
+            ok = lwriter_close(w);
+            ok = (fclose(f) == 0) && ok;
+        }
+
+        if (!ok)
+        {
+            lval_del(r);
+            r = lval_err("Could not write the profile to \"%s\": %s", path, strerror(errno));
+        }
+    }
+
+    if (out)
+        lprof_report(p, cpu, out);
+
+    lprof_entries_del(p->fns);
+    lprof_entries_del(p->stacks);
+    free(p->stack);
+    free(p);
+    return r;
+}
+
+
+#else
+
+
+lval* lprof_start(lctx* c)
+{
+    return lval_err("Profiling is not supported on this platform.");
+}
+
+
+lval* lprof_stop(lctx* c, char* path, FILE* out)
+{
+    return lval_err("The instance is not being profiled.");
+}
+
+
+#endif  /// _WIN32
@@ -0,0 +1,259 @@
+#include <seq.h>
+#include <array.h>
+#include <generator.h>
+#include <hamt.h>
+#include <lval.h>
+#include <utilities.h>
+
+#include <stdlib.h>
+
+
+///////////////////////////
+/// `lseq` Constructors ///
+///////////////////////////
+
+static lseq* lseq_new(int kind)
+{
+    lseq* s = malloc(sizeof(lseq));
+    s->refs = 1;
+    s->kind = kind;
+
+    s->start = 0;
+    s->end = 0;
+    s->step = 0;
+    s->n = 0;
+
+    s->src = NULL;
+    s->func = NULL;
+    s->inner = NULL;
+
+    return s;
+}
+
+
+lseq* lseq_range(long start, long end, long step)
+{
+    lseq* s = lseq_new(LSEQ_RANGE);
+    s->start = start;
+    s->end = end;
+    s->step = step;
+    return s;
+}
+
+
+lseq* lseq_qexpr(lval* q)
+{
+    lseq* s = lseq_new(LSEQ_QEXPR);
+    s->src = q;
+    return s;
+}
+
+
+lseq* lseq_stage(int kind, lval* func, long n, lseq* inner)
+{
+    lseq* s = lseq_new(kind);
+    s->func = func;
+    s->n = n;
+    s->inner = inner;
+    return s;
+}
+
+
+lseq* lseq_ref(lseq* s)
+{
+    s->refs++;
+    return s;
+}
+
+
+void lseq_unref(lseq* s)
+{
+    while (s && --s->refs == 0)
+    {
+        lseq* inner = s->inner;
+
+        if (s->src)
+            lval_del(s->src);
+
+        if (s->func)
+            lval_del(s->func);
+
+        free(s);
+        s = inner;
+    }
+}
+
+
+lseq* lseq_of(lval* v)
+{
+    if (v->type == LVAL_SEQ)
+        return lseq_ref(v->seq);
+
+    if (v->type == LVAL_QEXPR)
+        return lseq_qexpr(lval_copy(v));
+
+    if (v->type == LVAL_ARR)
+    {
+        lseq* s = lseq_new(LSEQ_ARRAY);
+        s->src = lval_copy(v);
+        return s;
+    }
+
+    if (v->type == LVAL_GEN)
+    {
+        lseq* s = lseq_new(LSEQ_GEN);
+        s->src = lval_copy(v);
+        return s;
+    }
+
+    if (v->type == LVAL_MAP)
+        return lseq_qexpr(lhamt_collect(v->hamt, LHAMT_PAIRS));
+
+    if (v->type == LVAL_SET)
+        return lseq_qexpr(lhamt_collect(v->hamt, LHAMT_KEYS));
+
+    return NULL;
+}
+
+
+////////////////////////
+/// `lseq` Iteration ///
+////////////////////////
+
+lseq_iter* lseq_iter_new(lseq* s)
+{
+    lseq_iter* it = malloc(sizeof(lseq_iter));
+    it->seq = lseq_ref(s);
+    it->pos = (s->kind == LSEQ_RANGE) ? s->start : 0;
+    it->done = 0;
+    it->inner = s->inner ? lseq_iter_new(s->inner) : NULL;
+    return it;
+}
+
+
+void lseq_iter_del(lseq_iter* it)
+{
+    while (it)
+    {
+        lseq_iter* inner = it->inner;
+        lseq_unref(it->seq);
+        free(it);
+        it = inner;
+    }
+}
+
+
+/// Applies a stage predicate to `x` without consuming it.
+/// Returns 1 or 0 for the truth of the result or -1 and
+/// sets `err` if the predicate fails.
+static int lseq_test(lenv* e, lval* f, lval* x, lval** err)
+{
+    lval* r = lval_apply(e, f, lval_add(lval_sexpr(), lval_copy(x)));
+
+    if (r->type == LVAL_ERR)
+    {
+        *err = r;
+        return -1;
+    }
+
+    if (r->type != LVAL_NUM)
+    {
+        *err = lval_err("Sequence predicate returned incorrect type. "
+                        "Got %s, Expected %s.",
+                        ltype_name(r->type), ltype_name(LVAL_NUM));
+        lval_del(r);
+        return -1;
+    }
+
+    int t = r->num != 0;
+    lval_del(r);
+    return t;
+}
+
+
+lval* lseq_iter_next(lenv* e, lseq_iter* it)
+{
+    if (it->done)
+        return NULL;
+
+    lseq* s = it->seq;
+    lval* x = NULL;
+    lval* err = NULL;
+
+    switch (s->kind)
+    {
+        case LSEQ_RANGE:
+            if ((s->step > 0 && it->pos < s->end)
+                || (s->step < 0 && it->pos > s->end))
+            {
+                x = lval_num(it->pos);
+                it->pos += s->step;
+            }
+            break;
+
+        case LSEQ_QEXPR:
+            if (it->pos < s->src->count)
+                x = lval_copy(s->src->cell[it->pos++]);
+            break;
+
+        case LSEQ_ARRAY:
+            if (it->pos < s->src->arr->count)
+                x = lval_copy(s->src->arr->items[it->pos++]);
+            break;
+
+        case LSEQ_GEN:
+            x = lgen_next(s->src->gen);
+            break;
+
+        case LSEQ_MAP:
+            x = lseq_iter_next(e, it->inner);
+
+            if (x && x->type != LVAL_ERR)
+                x = lval_apply(e, s->func, lval_add(lval_sexpr(), x));
+            break;
+
+        case LSEQ_FILTER:
+            while ((x = lseq_iter_next(e, it->inner)) && x->type != LVAL_ERR)
+            {
+                int t = lseq_test(e, s->func, x, &err);
+
+                if (t == 1)
+                    break;
+
+                lval_del(x);
+                x = err;
+
+                if (t == -1)
+                    break;
+            }
+            break;
+
+        case LSEQ_TAKE:
+            if (it->pos < s->n)
+            {
+                x = lseq_iter_next(e, it->inner);
+                it->pos++;
+            }
+            break;
+
+        case LSEQ_TAKE_WHILE:
+            x = lseq_iter_next(e, it->inner);
+
+            if (x && x->type != LVAL_ERR)
+            {
+                int t = lseq_test(e, s->func, x, &err);
+
+                if (t != 1)
+                {
+                    lval_del(x);
+                    x = err;
+                }
+            }
+            break;
+    }
+
+    if (x == NULL || x->type == LVAL_ERR)
+        it->done = 1;
+
+    return x;
+}
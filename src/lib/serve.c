@@ -0,0 +1,337 @@
+/// getline and open_memstream are POSIX.1-2008 interfaces.
+#define _XOPEN_SOURCE 700
+
+#include <serve.h>
+#include <ctx.h>
+#include <io.h>
+#include <lenv.h>
+#include <lval.h>
+#include <writer.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+
+static long long lserve_micros(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+
+/// Reads the next request from `in` into `req`. Returns
+/// the Number 1 on a request, 0 once `in` ends or an
+/// error if the request is malformed.
+static lval* lserve_read(FILE* in, char** req)
+{
+    char* line = NULL;
+    size_t cap = 0;
+    ssize_t n;
+
+    /// Blank lines (such as one ending a sized request)
+    /// are not requests.
+    do
+    {
+        n = getline(&line, &cap, in);
+
+        while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r'))
+            line[--n] = '\0';
+    }
+    while (n == 0);
+
+    if (n < 0)
+    {
+        free(line);
+        return lval_num(0);
+    }
+
+    if (line[0] != '#')
+    {
+        *req = line;
+        return lval_num(1);
+    }
+
+    char* end;
+    long len = strtol(line + 1, &end, 10);
+    int bad = end == line + 1 || *end != '\0';
+    free(line);
+
+    if (bad || len < 0 || len > LSERVE_MAX_REQUEST)
+        return lval_err("Malformed request header.");
+
+    *req = malloc(len + 1);
+
+    if (fread(*req, 1, len, in) != (size_t)len)
+    {
+        free(*req);
+        return lval_err("Request of %ld bytes ended early.", len);
+    }
+
+    (*req)[len] = '\0';
+    return lval_num(1);
+}
+
+
+/// Evaluates the request `src` and writes its response
+/// to `out`. Anything the request prints goes to
+/// `capture`, whose buffer is `data`.
+static void lserve_request(lctx* c, char* src, FILE* out, FILE* capture, char** data, size_t* size)
+{
+    /// A context of the request's own sends its output to
+    /// the capture and counts its calls from zero, while
+    /// sharing everything else with the warm instance.
+    lctx req;
+    lctx_fork(c, &req);
+    req.out = capture;
+
+    lenv* scope = lenv_child(c->env);
+    scope->ctx = &req;
+    scope->root = 1;
+    req.env = scope;
+
+    rewind(capture);
+
+    long long start = lserve_micros();
+    lval* x = lctx_eval(&req, src);
+    long long micros = lserve_micros() - start;
+
+    lval_fprintln(capture, x);
+    fflush(capture);
+
+    int was = lserve_pipe_block();
+
+    lwriter* w = lwriter_file(out);
+    lwriter_puts(w, (x->type == LVAL_ERR) ? "err " : "ok ");
+    lwriter_num(w, (long)*size);
+    lwriter_putc(w, ' ');
+    lwriter_num(w, (long)micros);
+    lwriter_putc(w, '\n');
+    lwriter_put(w, *data, (long)*size);
+    lwriter_close(w);
+    fflush(out);
+
+    lserve_pipe_unblock(was);
+
+    lval_del(x);
+    lenv_del(scope);
+}
+
+
+/////////////////////////
+/// Evaluation Server ///
+/////////////////////////
+
+lval* lserve_stream(lctx* c, FILE* in, FILE* out)
+{
+    char* data = NULL;
+    size_t size = 0;
+
+    /// Shared by every request of the stream rather than
+    /// opened for each, as tasks a request leaves behind
+    /// may still write to it.
+    FILE* capture = open_memstream(&data, &size);
+
+    if (capture == NULL)
+        return lval_err("Could not open a capture stream: %s", strerror(errno));
+
+    lval* r;
+
+    for (;;)
+    {
+        char* src = NULL;
+        r = lserve_read(in, &src);
+
+        if (r->type != LVAL_NUM || r->num == 0)
+            break;
+
+        lval_del(r);
+
+        lserve_request(c, src, out, capture, &data, &size);
+        free(src);
+    }
+
+    if (r->type == LVAL_NUM)
+    {
+        lval_del(r);
+        r = lval_sexpr();
+    }
+
+    fclose(capture);
+    free(data);
+    return r;
+}
+
+
+lval* lserve_socket(lctx* c, char* path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return lval_err("Socket path \"%s\" is too long.", path);
+
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return lval_err("socket failed: %s", strerror(errno));
+
+    unlink(path);
+
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        lval* err = lval_err("listen failed: %s", strerror(errno));
+        close(fd);
+        return err;
+    }
+
+    for (;;)
+    {
+        int conn = accept(fd, NULL, NULL);
+
+        if (conn < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+
+            lval* err = lval_err("accept failed: %s", strerror(errno));
+            close(fd);
+            return err;
+        }
+
+        FILE* in = fdopen(conn, "rb");
+        FILE* out = fdopen(dup(conn), "wb");
+
+        if (in && out)
+        {
+            lval* x = lserve_stream(c, in, out);
+
+            /// A malformed request only ends its connection.
+            if (x->type == LVAL_ERR)
+            {
+                int was = lserve_pipe_block();
+                lval_fprintln(out, x);
+                fflush(out);
+                lserve_pipe_unblock(was);
+            }
+
+            lval_del(x);
+        }
+
+        if (in)
+            fclose(in);
+        else
+            close(conn);
+
+        /// Responses are flushed as they are written,
+        /// so closing writes nothing.
+        if (out)
+            fclose(out);
+    }
+}
+
+
+///////////////
+/// Writing ///
+///////////////
+
+int lserve_pipe_block(void)
+{
+    sigset_t pipe, old;
+    sigemptyset(&pipe);
+    sigaddset(&pipe, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe, &old);
+
+    return sigismember(&old, SIGPIPE) == 1;
+}
+
+
+void lserve_pipe_unblock(int was)
+{
+    if (was)
+        return;
+
+    sigset_t pipe, pending;
+    sigemptyset(&pipe);
+    sigaddset(&pipe, SIGPIPE);
+
+    /// sigwait returns at once as one is pending.
+    int sig;
+    sigpending(&pending);
+
+    if (sigismember(&pending, SIGPIPE) == 1)
+        sigwait(&pipe, &sig);
+
+    pthread_sigmask(SIG_UNBLOCK, &pipe, NULL);
+}
+
+
+long lserve_send(int fd, const char* s, long n)
+{
+    long k;
+
+#ifdef MSG_NOSIGNAL
+    /// Sockets can say so themselves.
+    k = send(fd, s, n, MSG_NOSIGNAL);
+
+    if (k >= 0 || errno != ENOTSOCK)
+        return k;
+#endif
+
+    int was = lserve_pipe_block();
+    k = write(fd, s, n);
+
+    int err = errno;
+    lserve_pipe_unblock(was);
+    errno = err;
+
+    return k;
+}
+
+
+#else
+
+
+lval* lserve_stream(lctx* c, FILE* in, FILE* out)
+{
+    return lval_err("The evaluation server is not supported on this platform.");
+}
+
+
+lval* lserve_socket(lctx* c, char* path)
+{
+    return lval_err("The evaluation server is not supported on this platform.");
+}
+
+
+int lserve_pipe_block(void)
+{
+    return 1;
+}
+
+
+void lserve_pipe_unblock(int was)
+{
+}
+
+
+long lserve_send(int fd, const char* s, long n)
+{
+    return -1;
+}
+
+
+#endif  /// _WIN32
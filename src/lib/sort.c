@@ -0,0 +1,193 @@
+#include <sort.h>
+#include <builtins.h>
+#include <lval.h>
+#include <utilities.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LSORT_INSERTION_MAX 16
+
+
+/// State shared by every level of a single sort.
+typedef struct lsort_state
+{
+    lenv* e;
+    lval* f;
+    lval* err;
+
+    int native;
+    int numeric;
+    int dir;
+} lsort_state;
+
+
+typedef struct lsort_job
+{
+    lsort_state* s;
+    lval** items;
+    lval** tmp;
+    int n;
+    int depth;
+} lsort_job;
+
+
+static int lsort_less(lsort_state* s, lval* x, lval* y)
+{
+    if (s->numeric)
+        return (s->dir > 0) ? x->num < y->num : x->num > y->num;
+
+    if (s->native)
+        return lval_cmp(x, y) < 0;
+
+    if (s->err)
+        return 0;
+
+    lval* args = lval_add(lval_add(lval_sexpr(), lval_copy(x)), lval_copy(y));
+    lval* r = lval_apply(s->e, s->f, args);
+
+    if (r->type == LVAL_ERR)
+    {
+        s->err = r;
+        return 0;
+    }
+
+    if (r->type != LVAL_NUM)
+    {
+        s->err = lval_err("Function 'sort-by' comparator returned incorrect "
+                          "type. Got %s, Expected %s.",
+                          ltype_name(r->type), ltype_name(LVAL_NUM));
+        lval_del(r);
+        return 0;
+    }
+
+    int less = r->num != 0;
+    lval_del(r);
+    return less;
+}
+
+
+static void lsort_merge(lsort_state* s, lval** items, lval** tmp, int n)
+{
+    if (n <= LSORT_INSERTION_MAX)
+    {
+        for (int i = 1; i < n; i++)
+        {
+            lval* x = items[i];
+            int j = i;
+
+            for (; j > 0 && lsort_less(s, x, items[j - 1]); j--)
+                items[j] = items[j - 1];
+
+            items[j] = x;
+        }
+
+        return;
+    }
+
+    int h = n / 2;
+    int i = 0, j = h, k = 0;
+
+    while (i < h && j < n)
+        tmp[k++] = lsort_less(s, items[j], items[i]) ? items[j++] : items[i++];
+
+    while (i < h)
+        tmp[k++] = items[i++];
+
+    while (j < n)
+        tmp[k++] = items[j++];
+
+    memcpy(items, tmp, sizeof(lval*) * n);
+}
+
+
+static void* lsort_run(void* p);
+
+
+static void lsort_rec(lsort_state* s, lval** items, lval** tmp, int n, int depth)
+{
+    if (n > LSORT_INSERTION_MAX)
+    {
+        int h = n / 2;
+        lsort_job left = { s, items, tmp, h, depth - 1 };
+        pthread_t t;
+
+        if (depth > 0 && pthread_create(&t, NULL, lsort_run, &left) == 0)
+        {
+            lsort_rec(s, items + h, tmp + h, n - h, depth - 1);
+            pthread_join(t, NULL);
+        }
+        else
+        {
+            lsort_rec(s, items, tmp, h, 0);
+            lsort_rec(s, items + h, tmp + h, n - h, 0);
+        }
+
+        if (s->err)
+            return;
+    }
+
+    lsort_merge(s, items, tmp, n);
+}
+
+
+static void* lsort_run(void* p)
+{
+    lsort_job* job = p;
+    lsort_rec(job->s, job->items, job->tmp, job->n, job->depth);
+    return NULL;
+}
+
+
+lval* lsort(lenv* e, lval* f, lval** items, int n)
+{
+    lsort_state s = { e, f, NULL, f == NULL, 0, 1 };
+
+    if (f && f->type == LVAL_FUN && f->builtin)
+    {
+        if (f->builtin == builtin_gt || f->builtin == builtin_ge)
+            s.dir = -1;
+
+        s.numeric = s.dir < 0 || f->builtin == builtin_lt || f->builtin == builtin_le;
+
+        for (int i = 0; s.numeric && i < n; i++)
+            s.numeric = items[i]->type == LVAL_NUM;
+
+        s.native = s.numeric;
+    }
+
+    int depth = 0;
+
+    if (s.native && n >= LSORT_PARALLEL_MIN)
+        for (int t = lix_cpu_count(); t > 1; t = (t + 1) / 2)
+            depth++;
+
+    lval** tmp = malloc(sizeof(lval*) * (n ? n : 1));
+    lsort_rec(&s, items, tmp, n, depth);
+    free(tmp);
+
+    return s.err;
+}
+
+
+int lsort_search(lval** items, int n, lval* x)
+{
+    int lo = 0, hi = n;
+
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        int c = lval_cmp(items[mid], x);
+
+        if (c == 0)
+            return mid;
+
+        if (c < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return -1;
+}
@@ -0,0 +1,296 @@
+/// clock_gettime is a POSIX interface.
+#define _XOPEN_SOURCE 700
+
+#include <trace.h>
+#include <io.h>
+#include <lval.h>
+#include <writer.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <process.h>
+    #define getpid _getpid
+#else
+    #include <unistd.h>
+#endif  /// _WIN32
+
+#define LTRACE_MIN_STACK 64
+
+
+static long long ltrace_now(void)
+{
+    struct timespec ts;
+
+    #ifdef _WIN32
+        timespec_get(&ts, TIME_UTC);
+    #else
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+    #endif  /// _WIN32
+
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+
+/// Writes the chunks handed to it until told to stop.
+static void* ltrace_run(void* arg)
+{
+    ltrace* t = arg;
+
+    pthread_mutex_lock(&t->lock);
+
+    for (;;)
+    {
+        while (t->pending == NULL && !t->stop)
+            pthread_cond_wait(&t->cond, &t->lock);
+
+        lwriter* w = t->pending;
+
+        if (w == NULL)
+            break;
+
+        pthread_mutex_unlock(&t->lock);
+
+        int ok = fwrite(w->data, 1, w->len, t->file) == (size_t)w->len;
+        lwriter_close(w);
+
+        pthread_mutex_lock(&t->lock);
+        t->failed |= !ok;
+        t->pending = NULL;
+        pthread_cond_broadcast(&t->cond);
+    }
+
+    pthread_mutex_unlock(&t->lock);
+    return NULL;
+}
+
+
+/// Hands the events gathered in `t` to the writer thread,
+/// waiting for it to finish the last chunk first.
+static void ltrace_hand_off(ltrace* t)
+{
+    pthread_mutex_lock(&t->lock);
+
+    while (t->pending)
+        pthread_cond_wait(&t->cond, &t->lock);
+
+    t->pending = t->buf;
+    pthread_cond_broadcast(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+
+    t->buf = lwriter_str();
+}
+
+
+/// Writes `s` as the contents of a JSON string.
+static void ltrace_escape(lwriter* w, const char* s)
+{
+    for (; *s; s++)
+    {
+        unsigned char c = (unsigned char)*s;
+
+        if (c == '"' || c == '\\')
+        {
+            lwriter_putc(w, '\\');
+            lwriter_putc(w, c);
+        }
+        else if (c < 0x20)
+        {
+            char hex[8];
+            snprintf(hex, sizeof(hex), "\\u%04x", c);
+            lwriter_puts(w, hex);
+        }
+        else
+            lwriter_putc(w, c);
+    }
+}
+
+
+/// Writes the start of an event of phase `ph` at `ts`,
+/// leaving it open for the fields of its phase.
+static void ltrace_event(ltrace* t, char ph, char* cat, const char* name, long long ts)
+{
+    lwriter* w = t->buf;
+
+    lwriter_puts(w, ",\n{\"ph\":\"");
+    lwriter_putc(w, ph);
+    lwriter_puts(w, "\",\"cat\":\"");
+    lwriter_puts(w, cat);
+    lwriter_puts(w, "\",\"pid\":");
+    lwriter_num(w, t->pid);
+    lwriter_puts(w, ",\"tid\":1,\"ts\":");
+    lwriter_num(w, (long)(ts - t->start));
+
+    if (name)
+    {
+        lwriter_puts(w, ",\"name\":\"");
+        ltrace_escape(w, name);
+        lwriter_putc(w, '"');
+    }
+}
+
+
+static void ltrace_close_event(ltrace* t)
+{
+    lwriter_putc(t->buf, '}');
+
+    if (t->buf->len >= LTRACE_CHUNK)
+        ltrace_hand_off(t);
+}
+
+
+///////////////
+/// Tracing ///
+///////////////
+
+lval* ltrace_start(lctx* c, char* path, long threshold)
+{
+    if (c->trace)
+        return lval_err("The instance is already being traced.");
+
+    FILE* f = fopen(path, "w");
+
+    if (f == NULL)
+        return lval_err("Could not open the trace \"%s\": %s", path, strerror(errno));
+
+    ltrace* t = malloc(sizeof(ltrace));
+    t->file = f;
+    t->buf = lwriter_str();
+    t->pending = NULL;
+    t->stop = 0;
+    t->failed = 0;
+
+    t->start = ltrace_now();
+    t->threshold = threshold;
+    t->pid = (int)getpid();
+
+    t->cap = LTRACE_MIN_STACK;
+    t->depth = 0;
+    t->starts = malloc(sizeof(long long) * t->cap);
+
+    pthread_mutex_init(&t->lock, NULL);
+    pthread_cond_init(&t->cond, NULL);
+
+    /// Opened with a metadata event so every event after
+    /// it can start with a comma.
+    lwriter_puts(t->buf, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                         "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":");
+    lwriter_num(t->buf, t->pid);
+    lwriter_puts(t->buf, ",\"tid\":1,\"args\":{\"name\":\"lix\"}}");
+
+    if (pthread_create(&t->thread, NULL, ltrace_run, t) != 0)
+    {
+        lval* err = lval_err("Could not start the trace writer: %s", strerror(errno));
+        lwriter_close(t->buf);
+        fclose(f);
+        pthread_mutex_destroy(&t->lock);
+        pthread_cond_destroy(&t->cond);
+        free(t->starts);
+        free(t);
+        return err;
+    }
+
+    c->trace = t;
+    return lval_sexpr();
+}
+
+
+lval* ltrace_stop(lctx* c)
+{
+    ltrace* t = c->trace;
+
+    if (t == NULL)
+        return lval_err("The instance is not being traced.");
+
+    c->trace = NULL;
+
+    lwriter_puts(t->buf, "\n]}\n");
+    ltrace_hand_off(t);
+
+    pthread_mutex_lock(&t->lock);
+    t->stop = 1;
+    pthread_cond_broadcast(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+
+    pthread_join(t->thread, NULL);
+
+    int ok = !t->failed;
+    ok = (fclose(t->file) == 0) && ok;
+
+    lwriter_close(t->buf);
+    pthread_mutex_destroy(&t->lock);
+    pthread_cond_destroy(&t->cond);
+    free(t->starts);
+    free(t);
+
+    return ok ? lval_sexpr() : lval_err("Could not write the trace.");
+}
+
+
+void ltrace_begin(ltrace* t, char* cat, char* name)
+{
+    ltrace_event(t, 'B', cat, name, ltrace_now());
+    ltrace_close_event(t);
+}
+
+
+void ltrace_form(ltrace* t, lval* v)
+{
+    char* s = lval_show(v);
+
+    if (strlen(s) > LTRACE_NAME_MAX)
+    {
+        int cut = LTRACE_NAME_MAX - 3;
+
+        /// Not cut inside a UTF-8 sequence.
+        while (cut > 0 && (s[cut] & 0xC0) == 0x80)
+            cut--;
+
+        strcpy(s + cut, "...");
+    }
+
+    ltrace_begin(t, "form", s);
+    free(s);
+}
+
+
+void ltrace_end(ltrace* t, char* cat)
+{
+    ltrace_event(t, 'E', cat, NULL, ltrace_now());
+    ltrace_close_event(t);
+}
+
+
+void ltrace_enter(ltrace* t)
+{
+    if (t->depth == t->cap)
+    {
+        t->cap *= 2;
+        t->starts = realloc(t->starts, sizeof(long long) * t->cap);
+    }
+
+    t->starts[t->depth++] = ltrace_now();
+}
+
+
+void ltrace_leave(ltrace* t, lval* f)
+{
+    long long start = t->starts[--t->depth];
+
+    /// Anonymous lambdas are left out of the timeline.
+    if (f->sym == NULL)
+        return;
+
+    long long dur = ltrace_now() - start;
+
+    if (dur < t->threshold)
+        return;
+
+    ltrace_event(t, 'X', "call", f->sym, start);
+    lwriter_puts(t->buf, ",\"dur\":");
+    lwriter_num(t->buf, (long)dur);
+    ltrace_close_event(t);
+}
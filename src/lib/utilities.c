@@ -1,8 +1,13 @@
 #include <utilities.h>
 #include <types.h>
 
+#include <stdio.h>
+#include <stdlib.h>
+
 #ifdef _WIN32
 
+    #include <windows.h>
+
     static char buffer[2048];
 
     char* readline(char* prompt) 
@@ -16,6 +21,8 @@
     }
 
     void add_history(char* unused) {}
+#else
+    #include <unistd.h>
 #endif
 
 
@@ -44,7 +51,75 @@ char* ltype_name(int t)
         case LVAL_QEXPR:
             return "Q-Expression";
 
+        case LVAL_SEQ:
+            return "Sequence";
+
+        case LVAL_ARR:
+            return "Array";
+
+        case LVAL_MAP:
+            return "Hash-Map";
+
+        case LVAL_SET:
+            return "Hash-Set";
+
+        case LVAL_RECUR:
+            return "Recur";
+
+        case LVAL_FUT:
+            return "Future";
+
+        case LVAL_ACTOR:
+            return "Actor";
+
+        case LVAL_GEN:
+            return "Generator";
+
+        case LVAL_MOD:
+            return "Module";
+
         default:
             return "Unknown";
     }
 }
+
+
+int lix_cpu_count(void)
+{
+    #ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        long n = info.dwNumberOfProcessors;
+    #else
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+    #endif  /// _WIN32
+
+    return (n > 0) ? (int)n : 1;
+}
+
+
+char* lix_read_file(char* path, long* len)
+{
+    FILE* f = fopen(path, "rb");
+
+    if (f == NULL)
+        return NULL;
+
+    char* s = NULL;
+
+    if (fseek(f, 0, SEEK_END) == 0 && (*len = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0)
+    {
+        s = malloc(*len + 1);
+
+        if (fread(s, 1, *len, f) == (size_t)*len)
+            s[*len] = '\0';
+        else
+        {
+            free(s);
+            s = NULL;
+        }
+    }
+
+    fclose(f);
+    return s;
+}
@@ -0,0 +1,221 @@
+#include <writer.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <io.h>
+    #define write _write
+#else
+    #include <unistd.h>
+#endif  /// _WIN32
+
+#define LWRITER_MIN_SIZE 256
+
+
+static lwriter* lwriter_new(int sink, FILE* f, int fd)
+{
+    lwriter* w = malloc(sizeof(lwriter));
+    w->sink = sink;
+    w->file = f;
+    w->fd = fd;
+
+    w->data = NULL;
+    w->len = 0;
+    w->cap = 0;
+
+    w->failed = 0;
+    return w;
+}
+
+
+/// Writes `n` bytes at `s` to the sink of `w`, retrying
+/// partial and interrupted writes to a descriptor.
+static void lwriter_send(lwriter* w, const char* s, long n)
+{
+    if (w->failed)
+        return;
+
+    if (w->sink == LWRITER_FILE)
+    {
+        w->failed = fwrite(s, 1, n, w->file) != (size_t)n;
+        return;
+    }
+
+    for (long done = 0; done < n; )
+    {
+        long k = write(w->fd, s + done, n - done);
+
+        if (k < 0 && errno == EINTR)
+            continue;
+
+        if (k <= 0)
+        {
+            w->failed = 1;
+            return;
+        }
+
+        done += k;
+    }
+}
+
+
+static void lwriter_drain(lwriter* w)
+{
+    if (w->len > 0)
+        lwriter_send(w, w->data, w->len);
+
+    w->len = 0;
+}
+
+
+/// Makes room for `n` more bytes in `w`. Buffers start
+/// small so short prints stay cheap; a file writer's
+/// stops growing at LWRITER_BUFFER_SIZE and is drained
+/// instead.
+static void lwriter_grow(lwriter* w, long n)
+{
+    long limit = (w->sink == LWRITER_STR) ? LONG_MAX / 2 : LWRITER_BUFFER_SIZE;
+
+    if (w->len + n > limit)
+    {
+        lwriter_drain(w);
+
+        if (n > limit)
+            return;
+    }
+
+    long cap = w->cap ? w->cap : LWRITER_MIN_SIZE;
+
+    while (w->len + n > cap)
+        cap *= 2;
+
+    cap = (cap < limit) ? cap : limit;
+
+    if (cap != w->cap)
+    {
+        w->data = realloc(w->data, cap);
+        w->cap = cap;
+    }
+}
+
+
+//////////////////////////////
+/// `lwriter` Constructors ///
+//////////////////////////////
+
+lwriter* lwriter_file(FILE* f)
+{
+    return lwriter_new(LWRITER_FILE, f, -1);
+}
+
+
+lwriter* lwriter_fd(int fd)
+{
+    return lwriter_new(LWRITER_FD, NULL, fd);
+}
+
+
+lwriter* lwriter_str(void)
+{
+    return lwriter_new(LWRITER_STR, NULL, -1);
+}
+
+
+int lwriter_close(lwriter* w)
+{
+    if (w->sink != LWRITER_STR)
+        lwriter_drain(w);
+
+    int ok = !w->failed;
+
+    free(w->data);
+    free(w);
+    return ok;
+}
+
+
+char* lwriter_take(lwriter* w)
+{
+    lwriter_putc(w, '\0');
+
+    /// Shrunk as the string usually outlives the writer.
+    char* s = realloc(w->data, w->len);
+
+    free(w);
+    return s;
+}
+
+
+/////////////////////////
+/// `lwriter` Methods ///
+/////////////////////////
+
+void lwriter_put(lwriter* w, const char* s, long n)
+{
+    if (w->len + n > w->cap)
+        lwriter_grow(w, n);
+
+    /// Anything bigger than the buffer of a file writer
+    /// goes through without being copied.
+    if (w->len + n > w->cap)
+    {
+        lwriter_send(w, s, n);
+        return;
+    }
+
+    memcpy(w->data + w->len, s, n);
+    w->len += n;
+}
+
+
+void lwriter_putc(lwriter* w, char c)
+{
+    if (w->len < w->cap)
+        w->data[w->len++] = c;
+    else
+        lwriter_put(w, &c, 1);
+}
+
+
+void lwriter_puts(lwriter* w, const char* s)
+{
+    lwriter_put(w, s, strlen(s));
+}
+
+
+void lwriter_num(lwriter* w, long x)
+{
+    char digits[24];
+    int i = sizeof(digits);
+
+    /// Worked in negatives so LONG_MIN needs no
+    /// special case.
+    long n = (x < 0) ? x : -x;
+
+    do
+    {
+        digits[--i] = (char)('0' - n % 10);
+        n /= 10;
+    }
+    while (n);
+
+    if (x < 0)
+        digits[--i] = '-';
+
+    lwriter_put(w, digits + i, sizeof(digits) - i);
+}
+
+
+void lwriter_flush(lwriter* w)
+{
+    if (w->sink == LWRITER_STR)
+        return;
+
+    lwriter_drain(w);
+
+    if (w->sink == LWRITER_FILE && fflush(w->file) != 0)
+        w->failed = 1;
+}